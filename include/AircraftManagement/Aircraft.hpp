@@ -11,6 +11,18 @@ using nlohmann::json;
 using std::string;
 using std::vector;
 
+static constexpr const char* DEFAULT_CABIN_NAME = "Economy";
+
+// ==================== Cabin Class ====================
+
+// A cabin occupies a contiguous, 1-based range of rows
+struct CabinClass
+{
+	string name;
+	int firstRow;
+	int lastRow;
+};
+
 // ==================== Aircraft Class (Pure Data) ====================
 
 class Aircraft
@@ -24,11 +36,12 @@ private:
 	int rows;
 	int fleetCount;
 	string status;
+	vector<CabinClass> cabins;	// Front to back; empty means one Economy cabin
 	
 	// Private constructors - only AircraftManager and AircraftCreator can create
 	Aircraft(const string& aircraftType, const string& manufacturer, const string& model,
 	         int totalSeats, const string& seatLayout, int rows, int fleetCount,
-	         const string& status);
+	         const string& status, const vector<CabinClass>& cabins = {});
 	
 public:
 	// Getters
@@ -40,6 +53,7 @@ public:
 	int getRows() const noexcept;
 	int getFleetCount() const noexcept;
 	string getStatus() const noexcept;
+	vector<CabinClass> getCabins() const;
 	
 	// Setters
 	void setManufacturer(const string& manufacturer) noexcept;
@@ -49,6 +63,7 @@ public:
 	void setRows(int rows) noexcept;
 	void setFleetCount(int fleetCount) noexcept;
 	void setStatus(const string& status) noexcept;
+	void setCabins(const vector<CabinClass>& cabins);
 	
 	// Destructor
 	virtual ~Aircraft() noexcept = default;
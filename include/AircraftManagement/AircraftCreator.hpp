@@ -23,6 +23,7 @@ public:
 	static bool isValidSeatCount(int totalSeats);
 	static bool isValidRows(int rows);
 	static bool isValidFleetCount(int fleetCount);
+	static bool isValidCabins(const vector<CabinClass>& cabins, int rows);
 };
 
 // ==================== AircraftCreator ====================
@@ -40,6 +41,10 @@ private:
 	int getValidSeatCount();
 	int getValidRows();
 	int getValidFleetCount();
+	vector<CabinClass> getValidCabins(int rows);
+	
+	// Parses "First:1-2,Economy:3-30" style cabin definitions (throws AircraftException)
+	static vector<CabinClass> parseCabins(const string& input);
 	
 public:
 	AircraftCreator();
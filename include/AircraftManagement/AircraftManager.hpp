@@ -4,8 +4,11 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <shared_mutex>
 #include "Aircraft.hpp"
 #include "AircraftCreator.hpp"
+#include "SeatLayout.hpp"
 #include "Database.hpp"
 #include "UserInterface.hpp"
 
@@ -14,6 +17,22 @@ using std::vector;
 using std::unique_ptr;
 using std::shared_ptr;
 
+// Precomputed seat configuration for an aircraft type, cached by AircraftManager
+struct AircraftConfig
+{
+	string seatLayout;
+	int rows;
+	int seatsPerRow;
+	int totalSeats;
+	const SeatLayout* layout;
+	vector<CabinClass> cabins;	// Always at least one; invalid definitions fall back to Economy
+	vector<int> cabinSeats;		// Seat count per cabin
+	vector<int> rowCabins;		// Cabin index per 0-based row, so seat -> cabin is O(1)
+	
+	int getCabinIndex(int seatIndex) const noexcept;	// -1 if out of range
+	int findCabin(const string& cabinName) const noexcept;
+};
+
 // ==================== AircraftManager ====================
 
 class AircraftManager
@@ -24,6 +43,9 @@ private:
 	unique_ptr<Database> db;
 	UserInterface* ui;
 	unique_ptr<AircraftCreator> creator;
+	std::unordered_map<string, shared_ptr<const AircraftConfig>> configCache;
+	mutable std::shared_mutex configMutex;	// Guards configCache and configGeneration
+	unsigned long configGeneration;			// Bumped on invalidation so stale builds are not cached
 	
 	// Private constructor for singleton
 	AircraftManager();
@@ -39,6 +61,7 @@ private:
 	shared_ptr<Aircraft> loadAircraftFromDatabase(const string& aircraftType);
 	void saveAircraftToDatabase(const shared_ptr<Aircraft>& aircraft);
 	void deleteAircraftFromDatabase(const string& aircraftType);
+	void invalidateAircraftConfig(const string& aircraftType);
 	
 	// Helper for updating aircraft details
 	void updateAircraftDetails(const shared_ptr<Aircraft>& aircraft);
@@ -48,6 +71,7 @@ private:
 	
 	// Helper to display aircraft in a table format
 	void displayAircraftTable(const vector<shared_ptr<Aircraft>>& aircraft, const string& title = "");
+	static string formatCabins(const vector<CabinClass>& cabins);
 	
 public:
 	// Singleton accessor
@@ -58,6 +82,7 @@ public:
 	
 	// Query methods (for other classes to use)
 	shared_ptr<Aircraft> getAircraft(const string& aircraftType);
+	shared_ptr<const AircraftConfig> getAircraftConfig(const string& aircraftType);
 	vector<string> getAllAircraftTypes();
 	bool aircraftTypeExists(const string& aircraftType);
 	
@@ -3,6 +3,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
 #include <exception>
 #include <memory>
 #include "json.hpp"
@@ -11,6 +13,8 @@ using nlohmann::json;
 using std::string;
 using std::vector;
 
+static constexpr int CREW_CREDIT_HISTORY_MONTHS = 2;	// Months of credited flight numbers kept for de-duplication
+
 // ==================== Crew Enums ====================
 
 enum class CrewRole
@@ -37,6 +41,8 @@ private:
 	CrewRole role;
 	CrewStatus status;
 	double totalFlightHours;
+	std::map<string, double> monthlyHours;	// "YYYY-MM" -> hours flown; only months with hours
+	std::map<string, std::set<string>> creditedFlights;	// "YYYY-MM" -> flights already credited
 	
 	// Private constructor - only CrewManager can create
 	Crew(const string& crewId, const string& name, CrewRole role, CrewStatus status, double totalFlightHours);
@@ -52,12 +58,17 @@ public:
 	CrewStatus getStatus() const noexcept;
 	string getStatusString() const noexcept;
 	double getTotalFlightHours() const noexcept;
+	double getMonthlyHours(const string& month) const;
+	const std::map<string, double>& getMonthlyHoursHistory() const noexcept;
+	const std::map<string, std::set<string>>& getCreditedFlights() const noexcept;
 	
 	// Setters
 	void setName(const string& name) noexcept;
 	void setRole(CrewRole role) noexcept;
 	void setStatus(CrewStatus status) noexcept;
-	void addFlightHours(double hours) noexcept;
+	// Credits the total and the month; false if flightNumber was already credited
+	bool addFlightHours(double hours, const string& month, const string& flightNumber = "");
+	void pruneCreditedFlights(const string& oldestMonth);	// Forgets flights credited before oldestMonth
 	
 	// Validation methods
 	static bool isValidCrewId(const string& crewId);
@@ -66,6 +77,8 @@ public:
 	static CrewRole stringToRole(const string& roleStr);
 	static string statusToString(CrewStatus status) noexcept;
 	static CrewStatus stringToStatus(const string& statusStr);
+	static string getCurrentMonth();	// "YYYY-MM", local time
+	static string getMonthsAgo(int months);	// "YYYY-MM" that many months before the current one
 	
 	// Destructor
 	virtual ~Crew() noexcept = default;
@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <ctime>
 #include "Crew.hpp"
 #include "Database.hpp"
 #include "UserInterface.hpp"
@@ -13,6 +15,19 @@ using std::vector;
 using std::unique_ptr;
 using std::shared_ptr;
 
+static constexpr int CREW_ROLE_COUNT = 3;
+static constexpr int CREW_STATUS_COUNT = 3;
+
+// One change to a crew member's hours and status, applied by CrewManager::applyCrewLedger
+struct CrewLedgerEntry
+{
+	string crewId;
+	string flightNumber;	// Flight the hours are for; each flight is credited once. Empty: no de-duplication
+	double hours;			// Flight hours to credit; 0 for a status-only change
+	string month;			// "YYYY-MM" the hours count towards
+	CrewStatus newStatus;	// Not applied to members on leave
+};
+
 // ==================== CrewManager ====================
 
 class CrewManager
@@ -23,6 +38,20 @@ private:
 	unique_ptr<Database> db;
 	UserInterface* ui;
 	
+	// Crew by (role, status), built lazily from the database and kept current on every crew
+	// write. A status change swap-removes the member from one bucket and appends it to another,
+	// so both the move and an availability lookup avoid the database entirely. Entries are
+	// copies taken at write time and never modified afterwards.
+	struct CrewSlot
+	{
+		CrewRole role;
+		CrewStatus status;
+		size_t position;	// Index within the bucket
+	};
+	vector<shared_ptr<Crew>> crewBuckets[CREW_ROLE_COUNT][CREW_STATUS_COUNT];
+	std::unordered_map<string, CrewSlot> crewSlots;
+	bool crewIndexBuilt = false;
+	
 	// Private constructor for singleton
 	CrewManager();
 	
@@ -32,11 +61,20 @@ private:
 	void viewCrewDetails();
 	void updateCrewMember();
 	void removeCrewMember();
+	void rosterFlights();
 	
 	// Helper methods
 	shared_ptr<Crew> loadCrewFromDatabase(const string& crewId);
 	void saveCrewToDatabase(const shared_ptr<Crew>& crew);
 	void deleteCrewFromDatabase(const string& crewId);
+	static json crewToJson(const shared_ptr<Crew>& crew);
+	static shared_ptr<Crew> crewFromJson(const string& crewId, const json& crewData);
+	
+	// Crew index helpers
+	void buildCrewIndex();
+	void indexCrew(const shared_ptr<Crew>& crew);
+	void unindexCrew(const string& crewId);
+	vector<shared_ptr<Crew>>& getCrewBucket(CrewRole role, CrewStatus status);
 	
 	// Helper for updating crew details
 	void updateCrewDetails(const shared_ptr<Crew>& crew);
@@ -53,15 +91,17 @@ public:
 	
 	// Query methods (for other classes to use)
 	shared_ptr<Crew> getCrew(const string& crewId);
-	vector<shared_ptr<Crew>> getAvailableCrew(CrewRole role);
+	vector<shared_ptr<Crew>> getAvailableCrew(CrewRole role, std::time_t from, std::time_t to);	// Not on leave, no duty in [from, to)
 	vector<string> getAllCrewIds();
 	vector<shared_ptr<Crew>> getAllCrew();
 	bool crewExists(const string& crewId);
 	
-	// Status update methods (for FlightManager to use)
-	void markCrewAsAssigned(const string& crewId);
-	void markCrewAsAvailable(const string& crewId);
-	void addFlightHoursForCrew(const string& crewId, double hours);
+	// The stored status only records leave; Assigned or Available follows from upcoming duties
+	CrewStatus getEffectiveStatus(const shared_ptr<Crew>& crew);
+	
+	// Applies every entry in memory, in order, then persists all affected members with one write.
+	// Replaying entries for an already credited flight changes nothing, so retries are safe.
+	void applyCrewLedger(const vector<CrewLedgerEntry>& entries);
 	
 	// Cascade check (for deletion operations)
 	static bool isCrewAssignedToFlights(const string& crewId);
@@ -0,0 +1,81 @@
+#ifndef CREWROSTER_HPP
+#define CREWROSTER_HPP
+
+#include <string>
+#include <vector>
+#include <ctime>
+#include <cstdint>
+#include "Crew.hpp"
+
+using std::string;
+using std::vector;
+
+static constexpr int ROSTER_PILOTS_PER_FLIGHT = 1;
+static constexpr int ROSTER_COPILOTS_PER_FLIGHT = 1;
+static constexpr int ROSTER_ATTENDANTS_PER_FLIGHT = 2;
+static constexpr int CREW_MIN_REST_HOURS = 10;			// Between one arrival and the next departure
+static constexpr double CREW_MAX_MONTHLY_HOURS = 100.0;	// Flight hours per calendar month
+static constexpr double CREW_FATIGUE_WARNING_HOURS = 80.0;	// Monthly hours flagged in the crew report
+static constexpr int ROSTER_REPAIR_ROUNDS = 8;			// Local search passes over unfilled slots
+
+// ==================== Roster Input & Result ====================
+
+struct RosterFlight
+{
+	string flightNumber;
+	std::time_t departure;
+	std::time_t arrival;
+	double hours;
+	int month;					// year * 12 + month of departure, for the monthly hour limit
+	vector<string> assignedCrew;	// Already on the flight; only the remaining slots are rostered
+};
+
+// A crew member and the flights they already fly, which the roster must work around
+struct RosterCrew
+{
+	string crewId;
+	CrewRole role;
+	vector<RosterFlight> commitments;
+};
+
+struct RosterResult
+{
+	vector<std::pair<string, string>> assignments;	// (flight number, crew ID), in departure order
+	int slotsRequired = 0;
+	int slotsFilled = 0;
+	vector<string> understaffedFlights;
+	size_t threadsUsed = 0;
+};
+
+// ==================== CrewRoster Class ====================
+
+// Assigns pilots, copilots and attendants to a window of flights. No member flies two
+// overlapping flights, every member rests CREW_MIN_REST_HOURS between flights, and nobody
+// exceeds CREW_MAX_MONTHLY_HOURS in a month. Each thread builds a greedy roster (least-loaded
+// feasible member first, with seeded tie-breaking), then repairs unfilled slots by handing a
+// blocking flight to another member; the roster filling most slots with the most even
+// hours wins.
+class CrewRoster
+{
+private:
+	vector<RosterFlight> flights;	// Sorted by departure
+	vector<RosterCrew> crew;
+	
+	struct Attempt;
+	
+	// Helper methods
+	Attempt solveWithSeed(uint32_t seed) const;
+	
+public:
+	// Constructor
+	CrewRoster(vector<RosterFlight> flights, vector<RosterCrew> crew);
+	
+	// Runs one search per hardware thread and returns the best roster
+	RosterResult solve() const;
+	
+	static int getRequiredCount(CrewRole role) noexcept;
+	
+	~CrewRoster() noexcept = default;
+};
+
+#endif // CREWROSTER_HPP
@@ -5,12 +5,26 @@
 #include <vector>
 #include <exception>
 #include <memory>
+#include <ctime>
 #include "json.hpp"
+#include "SeatBitset.hpp"
 
 using nlohmann::json;
 using std::string;
 using std::vector;
 
+// ==================== Fare Bucket ====================
+
+// Fare and sold-seat counter for one cabin; availability is the cabin's seat count minus `sold`
+struct FareBucket
+{
+	string cabin;
+	double price;
+	int sold;
+	int firstRow = 0;	// Cabin rows `sold` was counted over; 0 if unknown, which forces a recount
+	int lastRow = 0;
+};
+
 // ==================== Flight Class (Pure Data) ====================
 
 class Flight
@@ -23,19 +37,29 @@ private:
 	string arrivalDateTime;
 	string aircraftType;
 	string status;
-	double price;
+	double price;		// Lead-in fare: the lowest cabin fare, also charged for unassigned seats
 	string gate;
 	string boardingTime;
-	vector<string> reservedSeats;
+	SeatBitset seatOccupancy;
 	vector<string> assignedCrewIds;
+	vector<FareBucket> fareBuckets;	// One per aircraft cabin, in cabin order
 	
 	// Private constructors - only FlightManager and FlightCreator can create
 	Flight(const string& flightNumber, const string& origin, const string& destination,
 	       const string& departureDateTime, const string& arrivalDateTime,
 	       const string& aircraftType, const string& status, double price,
 	       const string& gate, const string& boardingTime,
-	       const vector<string>& reservedSeats = {},
-	       const vector<string>& assignedCrewIds = {});
+	       const SeatBitset& seatOccupancy = SeatBitset(),
+	       const vector<string>& assignedCrewIds = {},
+	       const vector<FareBucket>& fareBuckets = {});
+	
+	// Resolves a "12C" style seat number to its seat index (-1 if invalid for this aircraft)
+	int getSeatIndex(const string& seatNumber) const;
+	
+	// Orders buckets by the aircraft's cabins. Stored sold counters are kept while their cabin's rows
+	// are unchanged; renamed, added or resized cabins are recounted from occupancy
+	void alignFareBuckets();
+	void adjustSoldCount(int seatIndex, int delta);
 	
 	friend class FlightManager;
 	friend class FlightCreator;
@@ -54,15 +78,24 @@ public:
 	int getAvailableSeats() const;
 	string getGate() const noexcept;
 	string getBoardingTime() const noexcept;
-	vector<string> getReservedSeats() const noexcept;
+	vector<string> getReservedSeats() const;
+	int getReservedSeatCount() const noexcept;
+	const SeatBitset& getSeatOccupancy() const noexcept;
 	vector<string> getAssignedCrew() const noexcept;
 	
+	// Fare buckets
+	const vector<FareBucket>& getFareBuckets() const noexcept;
+	int getCabinAvailableSeats(size_t cabinIndex) const;
+	int getSeatCabin(const string& seatNumber) const;	// -1 if unassigned or invalid
+	double getSeatPrice(const string& seatNumber) const;	// Lead-in fare if unassigned or invalid
+	void setCabinPrice(size_t cabinIndex, double price);
+	
 	// Setters
 	void setOrigin(const string& origin) noexcept;
 	void setDestination(const string& destination) noexcept;
 	void setDepartureDateTime(const string& departureDateTime) noexcept;
 	void setArrivalDateTime(const string& arrivalDateTime) noexcept;
-	void setAircraftType(const string& aircraftType) noexcept;
+	void setAircraftType(const string& aircraftType);	// Re-aligns fare buckets; may throw
 	void setStatus(const string& status) noexcept;
 	void setPrice(double price) noexcept;
 	void setGate(const string& gate) noexcept;
@@ -79,6 +112,12 @@ public:
 	bool hasCrewMember(const string& crewId) const noexcept;
 	double getFlightDuration() const;
 	
+	// Local time of a "YYYY-MM-DD HH:MM" timestamp; -1 if it does not parse
+	static std::time_t parseDateTime(const string& dateTime);
+	
+	// Clock-time difference in hours; an arrival at or before the departure time is taken as next day
+	static double getFlightDuration(const string& departureDateTime, const string& arrivalDateTime);
+	
 	// Destructor
 	virtual ~Flight() noexcept = default;
 };
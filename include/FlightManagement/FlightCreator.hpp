@@ -38,7 +38,7 @@ private:
 	string getValidArrivalDateTime();
 	string getValidAircraftType();
 	string getValidStatus();
-	double getValidPrice();
+	double getValidPrice(const string& label = "");
 	
 	// Helper to validate date/time format: YYYY-MM-DD HH:MM
 	static bool validateDateTimeFormat(const string& dateTime);
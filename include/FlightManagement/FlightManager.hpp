@@ -4,8 +4,20 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <shared_mutex>
+#include <ctime>
 #include "Flight.hpp"
+#include "SeatInventory.hpp"
+#include "SeatAllocator.hpp"
+#include "SeatMap.hpp"
+#include "TimerWheel.hpp"
+#include "IntervalTree.hpp"
 #include "FlightCreator.hpp"
+#include "CrewRoster.hpp"
 #include "Database.hpp"
 #include "UserInterface.hpp"
 
@@ -14,6 +26,10 @@ using std::vector;
 using std::unique_ptr;
 using std::shared_ptr;
 
+static constexpr int SEAT_HOLD_MINUTES = 10;
+static constexpr int FLIGHT_COMPLETION_SWEEP_MINUTES = 5;
+static constexpr int FLIGHT_COMPLETION_GRACE_MINUTES = 30;	// After the scheduled arrival
+
 // ==================== FlightManager ====================
 
 class FlightManager
@@ -25,6 +41,53 @@ private:
 	UserInterface* ui;
 	unique_ptr<FlightCreator> creator;
 	
+	// Per-flight seat authority, built lazily from the database on first seat operation
+	std::unordered_map<string, shared_ptr<SeatInventory>> seatInventories;
+	mutable std::shared_mutex inventoryMutex;
+	
+	// Seat holds placed during booking; the timer wheel releases them after SEAT_HOLD_MINUTES
+	struct SeatHold
+	{
+		string flightNumber;
+		int seatIndex;
+		shared_ptr<SeatInventory> inventory;
+	};
+	TimerWheel holdTimers;
+	std::unordered_map<uint64_t, SeatHold> seatHolds;
+	std::mutex holdMutex;
+	
+	// Rendered seat maps, kept per flight and patched cell-by-cell as occupancy changes
+	struct SeatMapView
+	{
+		shared_ptr<SeatInventory> inventory;	// Inventory the view was rendered from
+		unique_ptr<SeatMap> seatMap;
+		vector<string> rowLabels;
+		vector<vector<string>> gridData;
+	};
+	std::unordered_map<string, SeatMapView> seatMapViews;
+	std::mutex seatMapMutex;
+	
+	// Scheduled arrivals of flights not yet completed or canceled, soonest first. Built lazily,
+	// kept current on every flight write, and drained by the completion sweep; an overdue flight
+	// that never departed leaves the queue after one check and returns when it is next saved.
+	std::multimap<std::time_t, string> arrivalQueue;
+	std::unordered_map<string, std::multimap<std::time_t, string>::iterator> arrivalEntries;
+	bool arrivalQueueBuilt = false;
+	std::mutex arrivalMutex;
+	
+	// Reverse indexes from crew member and aircraft type to flights, built lazily from the raw
+	// flight records and diffed against each flight's previous values on every flight write.
+	// dutiesByCrew holds the departure-to-arrival window of each member's non-canceled flights;
+	// crewedDuties answers "who is busy in this window" without visiting every member.
+	std::unordered_map<string, std::set<string>> flightsByCrew;
+	std::unordered_map<string, vector<string>> crewByFlight;
+	std::unordered_map<string, IntervalTree> dutiesByCrew;
+	IntervalTree crewedDuties;	// The same windows keyed by flight, for flights with any crew
+	std::unordered_map<string, std::set<string>> flightsByAircraftType;
+	std::unordered_map<string, string> aircraftTypeByFlight;
+	bool flightIndexesBuilt = false;
+	std::mutex flightIndexMutex;
+	
 	// Private constructor for singleton
 	FlightManager();
 	
@@ -39,7 +102,37 @@ private:
 	shared_ptr<Flight> loadFlightFromDatabase(const string& flightNumber);
 	void saveFlightToDatabase(const shared_ptr<Flight>& flight);
 	void deleteFlightFromDatabase(const string& flightNumber);
-	void updateCrewFlightHours(const shared_ptr<Flight>& flight);
+	
+	// Reverse index helpers (caller holds flightIndexMutex)
+	void buildFlightIndexes();
+	void indexFlightCrew(const string& flightNumber, const vector<string>& crewIds,
+	                     std::pair<std::time_t, std::time_t> dutyWindow = {-1, -1});	// {-1, -1}: no duty
+	void indexFlightAircraft(const string& flightNumber, const string& aircraftType);	// Empty removes
+	
+	// Departure and arrival of a flight that occupies its crew; {-1, -1} if canceled or unparseable.
+	// An arrival not after the departure is replaced by departure plus Flight::getFlightDuration.
+	static std::pair<std::time_t, std::time_t> getDutyWindow(const string& status, const string& departure,
+	                                                         const string& arrival);
+	
+	// Crew rostering helpers
+	static bool toRosterFlight(const shared_ptr<Flight>& flight, RosterFlight& rosterFlight);
+	void applyCrewAssignments(const vector<std::pair<string, string>>& assignments);
+	
+	// Arrival queue helpers (caller holds arrivalMutex)
+	void buildArrivalQueue();
+	void scheduleArrival(const shared_ptr<Flight>& flight);
+	void unscheduleArrival(const string& flightNumber);
+	
+	// Seat inventory helpers
+	shared_ptr<SeatInventory> getSeatInventory(const string& flightNumber);
+	vector<int> resolveSeatIndexes(const shared_ptr<SeatInventory>& inventory, const vector<string>& seatNumbers);
+	void persistSeatInventory(const string& flightNumber, const shared_ptr<SeatInventory>& inventory);
+	bool handOverReleasedSeat(const string& flightNumber, const string& seatNumber);	// Seat stays reserved if true
+	void persistSeatInventories(const std::map<string, shared_ptr<SeatInventory>>& inventories);	// One journal record
+	static json soldCounters(const shared_ptr<SeatInventory>& inventory);
+	void dropSeatInventory(const string& flightNumber);
+	void expireSeatHolds();
+	void releaseExpiredHolds();	// Caller holds holdMutex
 	
 	// Helper for updating flight details
 	void updateFlightDetails(const shared_ptr<Flight>& flight);
@@ -49,6 +142,7 @@ private:
 	
 	// Helper to display flights in a table format
 	void displayFlightsTable(const vector<shared_ptr<Flight>>& flights, const string& title = "");
+	static string formatCabinAvailability(const shared_ptr<Flight>& flight);
 	
 public:
 	// Singleton accessor
@@ -64,13 +158,58 @@ public:
 	vector<string> getAllFlightNumbers();
 	vector<shared_ptr<Flight>> getAllFlights();
 	bool flightExists(const string& flightNumber);
+	vector<string> getFlightsForCrew(const string& crewId);	// Sorted flight numbers
+	vector<string> getFlightsByAircraftType(const string& aircraftType);	// Sorted flight numbers
+	bool isAircraftTypeInUse(const string& aircraftType);
+	
+	// Time-aware crew availability: O(log n + k) lookups in the member's duty intervals
+	bool isCrewFree(const string& crewId, std::time_t start, std::time_t end);
+	vector<string> getCrewConflicts(const string& crewId, std::time_t start, std::time_t end);	// In departure order
+	std::unordered_set<string> getBusyCrew(std::time_t start, std::time_t end);	// O(log n + k) over overlapping flights
 	
 	// Deletion check (for cascade operations)
 	static bool hasActiveReservations(const string& flightNumber);
 
 	// Reserve Seats
 	bool reserveSeatForFlight(const string& flightNumber, const string& seatNumber);
-	bool releaseSeatForFlight(const string& flightNumber, const string& seatNumber);
+	bool reserveSeatsForFlight(const string& flightNumber, const vector<string>& seatNumbers);	// All or nothing
+	bool releaseSeatForFlight(const string& flightNumber, const string& seatNumber);	// Promotes the waitlist head first
+	
+	// Batch bookings: each seat succeeds or fails on its own, persisted with one journal record
+	vector<bool> reserveAvailableSeats(const string& flightNumber, const vector<string>& seatNumbers);
+	void releaseSeatsForFlight(const string& flightNumber, const vector<string>& seatNumbers);
+	
+	// Seat holds: hold returns a hold id (0 if the seat is unavailable)
+	uint64_t holdSeatForFlight(const string& flightNumber, const string& seatNumber);
+	bool commitSeatHold(uint64_t holdId);
+	void releaseSeatHold(uint64_t holdId);
+	
+	// Batch holds for parties: all seats are held (or committed) together, or none are
+	vector<uint64_t> holdSeatsForFlight(const string& flightNumber, const vector<string>& seatNumbers);
+	bool commitSeatHolds(const vector<uint64_t>& holdIds);
+	void releaseSeatHolds(const vector<uint64_t>& holdIds);
+	
+	// Best block of free seats for a party (empty if none fits the preferences); excludedSeats are
+	// treated as taken, e.g. seats other passengers of the same batch are about to reserve
+	vector<string> findGroupSeats(const string& flightNumber, const SeatPreferences& preferences,
+	                              const vector<string>& excludedSeats = {});
+	void getSeatState(const string& flightNumber, SeatBitset& reservedSeats, SeatBitset& heldSeats);
+	void displaySeatMap(const string& flightNumber);
+	int getAvailableSeatCount(const string& flightNumber);	// Neither reserved nor held
+	
+	// Drops cached seat inventories for flights on an aircraft whose configuration changed
+	void invalidateSeatInventories(const string& aircraftType);
+	
+	// Flight completion: reservations become COMPLETED, crew are credited their hours and released,
+	// and the flights are marked "Completed", each step one batched write across all the flights
+	size_t completeFlights(const vector<shared_ptr<Flight>>& flights);
+	
+	// Completes Departed or Arrived flights whose arrival is past the grace period (registered with JobScheduler)
+	size_t completeArrivedFlights();
+	
+	// Fills the open crew slots of scheduled flights departing between two dates (inclusive,
+	// "YYYY-MM-DD") and saves the assignments with one flight write and one crew write
+	RosterResult rosterCrew(const string& fromDate, const string& toDate);
 	
 	// Destructor
 	~FlightManager() noexcept;
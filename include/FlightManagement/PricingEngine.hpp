@@ -0,0 +1,114 @@
+#ifndef PRICINGENGINE_HPP
+#define PRICINGENGINE_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <shared_mutex>
+#include <ctime>
+#include "Flight.hpp"
+#include "SeatInventory.hpp"
+
+using std::string;
+using std::vector;
+using std::shared_ptr;
+
+// ==================== Pricing Rules ====================
+
+// A fare multiplier that applies from `threshold` on (load factor, or days before departure)
+struct PricingTier
+{
+	double threshold;
+	double multiplier;
+};
+
+// Cabin load factor (reserved / cabin seats), ascending: the last tier reached applies
+static constexpr PricingTier LOAD_FACTOR_TIERS[] = {
+	{0.00, 1.00},
+	{0.50, 1.10},
+	{0.70, 1.25},
+	{0.85, 1.45},
+	{0.95, 1.70}
+};
+
+// Days to departure, descending: the first tier the flight is still at or beyond applies
+static constexpr PricingTier ADVANCE_PURCHASE_TIERS[] = {
+	{60, 0.85},
+	{30, 0.95},
+	{14, 1.00},
+	{7, 1.15},
+	{3, 1.30},
+	{0, 1.50}
+};
+
+// ==================== Price Curve ====================
+
+// Every fare a flight can have until it crosses into the next advance-purchase tier. The
+// fare-bucket price is the base fare; faresBySold holds it scaled for each possible number
+// of seats sold, so a seat change only moves an index and a quote only reads currentFares.
+struct PriceCurve
+{
+	std::time_t validUntil;				// When days-to-departure enters the next tier
+	vector<vector<double>> faresBySold;	// [cabin][seats sold]
+	vector<int> sold;					// [cabin]
+	vector<double> currentFares;		// [cabin] at the current load
+	double leadInFare;					// Lowest current cabin fare; charged for unassigned seats
+	int leadInCabin;					// Cabin quoting the lead-in fare
+};
+
+// ==================== PricingEngine ====================
+
+class PricingEngine
+{
+private:
+	static PricingEngine* instance;
+	
+	std::unordered_map<string, PriceCurve> curves;	// Built on a flight's first quote
+	mutable std::shared_mutex mutex;
+	
+	// Private constructor for singleton
+	PricingEngine() = default;
+	
+	// Helper methods
+	static bool buildCurve(const shared_ptr<Flight>& flight, std::time_t now, PriceCurve& curve);
+	static void applyLoad(PriceCurve& curve, size_t cabinIndex, int sold);
+	static double fareAt(const PriceCurve& curve, int cabinIndex) noexcept;
+	
+public:
+	// Singleton accessor
+	static PricingEngine* getInstance();
+	
+	// Quotes: O(1) reads of the cached curve; cabin -1 (or an unassigned seat) quotes the lead-in fare
+	double quoteCabin(const shared_ptr<Flight>& flight, int cabinIndex);
+	double quoteSeat(const shared_ptr<Flight>& flight, const string& seatNumber);
+	double quoteLeadIn(const shared_ptr<Flight>& flight);
+	
+	// Cabin whose fare the lead-in quotes; seats booked or promised at that fare come from it (-1 if no cabins)
+	int getLeadInCabin(const shared_ptr<Flight>& flight);
+	
+	// Quotes a party in booking order before any of its seats is sold: each seat is priced at the
+	// current load plus the seats listed before it in the same cabin
+	vector<double> quoteSeats(const shared_ptr<Flight>& flight, const vector<string>& seatNumbers);
+	
+	// Re-evaluates a cached curve after a seat change, from the inventory's per-cabin counters
+	void recordLoad(const string& flightNumber, const SeatInventory& inventory);
+	
+	// Drops a flight's curve when its fares, schedule or aircraft change
+	void invalidate(const string& flightNumber);
+	
+	// Rule lookups
+	static double getLoadFactorMultiplier(double loadFactor) noexcept;
+	static double getAdvancePurchaseMultiplier(double daysToDeparture) noexcept;
+	
+	// Destructor
+	~PricingEngine() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	PricingEngine(const PricingEngine&) = delete;
+	PricingEngine(PricingEngine&&) = delete;
+	PricingEngine& operator=(const PricingEngine&) = delete;
+	PricingEngine& operator=(PricingEngine&&) = delete;
+};
+
+#endif // PRICINGENGINE_HPP
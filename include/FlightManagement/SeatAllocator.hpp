@@ -0,0 +1,75 @@
+#ifndef SEATALLOCATOR_HPP
+#define SEATALLOCATOR_HPP
+
+#include <vector>
+#include <utility>
+#include "SeatBitset.hpp"
+#include "SeatLayout.hpp"
+
+using std::vector;
+
+// ==================== Seat Preferences ====================
+
+enum class SeatPosition
+{
+	ANY,
+	WINDOW,
+	AISLE
+};
+
+enum class GroupArrangement
+{
+	SAME_ROW,		// Whole party in one row
+	ADJACENT_ROWS,	// Same row if possible, otherwise split across two consecutive rows
+	ANYWHERE		// Together if possible, otherwise any free seats
+};
+
+struct SeatPreferences
+{
+	int partySize = 1;
+	SeatPosition position = SeatPosition::ANY;
+	GroupArrangement arrangement = GroupArrangement::ADJACENT_ROWS;
+	int cabin = -1;			// Cabin index to seat the party in; -1 takes the first cabin that fits
+	bool partial = false;	// ANYWHERE only: return as many free seats as there are, up to partySize
+};
+
+// ==================== SeatAllocator Class ====================
+
+// Finds the best block of free seats for a party by scanning the occupancy bitmap row by row.
+// Blocks that stay within one section (no aisle between members) rank first, then blocks
+// crossing an aisle, then splits over two adjacent rows; position preference breaks ties.
+// A party is always seated within one cabin's rows.
+class SeatAllocator
+{
+private:
+	const SeatLayout& layout;
+	int rows;
+	vector<std::pair<int, int>> cabinRows;	// First and last 1-based row per cabin
+	
+	// Helper methods
+	bool isBlockFree(const SeatBitset& occupied, int row, int firstOrdinal, int count) const;
+	int scoreBlock(int row, int firstOrdinal, int count, SeatPosition position) const;
+	int aisleCrossings(int firstOrdinal, int count) const;
+	void appendBlock(vector<int>& seats, int row, int firstOrdinal, int count) const;
+	bool allocateInRows(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+	                    vector<int>& seats) const;
+	
+	bool findSameRow(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+	                 vector<int>& seats) const;
+	bool findAdjacentRows(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+	                      vector<int>& seats) const;
+	bool findAnywhere(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+	                  vector<int>& seats) const;
+	
+public:
+	// Constructor - rowCabins maps each 0-based row to its cabin; empty means a single cabin
+	SeatAllocator(const SeatLayout& layout, int rows, const vector<int>& rowCabins = {});
+	
+	// Returns seat indexes for the party (empty if no arrangement satisfies the preferences).
+	// `occupied` marks every seat that is reserved or held.
+	vector<int> allocate(const SeatBitset& occupied, const SeatPreferences& preferences) const;
+	
+	~SeatAllocator() noexcept = default;
+};
+
+#endif // SEATALLOCATOR_HPP
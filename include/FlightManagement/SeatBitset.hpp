@@ -0,0 +1,47 @@
+#ifndef SEATBITSET_HPP
+#define SEATBITSET_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using std::string;
+using std::vector;
+
+// ==================== SeatBitset Class ====================
+
+// Dynamic occupancy bitset indexed by seat index (row-major: (row - 1) * seatsPerRow + letter ordinal)
+class SeatBitset
+{
+private:
+	vector<uint64_t> words;
+	int seatCount;
+
+public:
+	// Constructors
+	SeatBitset();
+	explicit SeatBitset(int seatCount);
+
+	// Capacity
+	int size() const noexcept;
+	void resize(int seatCount);
+	void clear() noexcept;
+
+	// Bit operations (out-of-range indexes are never set)
+	bool test(int index) const noexcept;
+	bool set(int index) noexcept;      // Returns false if already set
+	bool reset(int index) noexcept;    // Returns false if not set
+	int count() const noexcept;        // Popcount of all words
+	int count(int first, int last) const noexcept;  // Popcount of indexes [first, last)
+
+	// Raw access for word-level scans
+	const vector<uint64_t>& getWords() const noexcept;
+
+	// Compact serialization: one hex nibble per 4 seats, trailing zero nibbles trimmed
+	string toHex() const;
+	static SeatBitset fromHex(const string& hex, int seatCount);
+
+	~SeatBitset() noexcept = default;
+};
+
+#endif // SEATBITSET_HPP
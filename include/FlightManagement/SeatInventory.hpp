@@ -0,0 +1,99 @@
+#ifndef SEATINVENTORY_HPP
+#define SEATINVENTORY_HPP
+
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <vector>
+#include "SeatBitset.hpp"
+#include "SeatLayout.hpp"
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+// ==================== SeatInventory Class ====================
+
+// In-memory seat authority for one flight. Each seat is a 2-bit state in an array of atomic
+// words; every state change is a single compare-and-swap, so concurrent bookings on the
+// same flight never take a lock and can never both win the same seat.
+class SeatInventory
+{
+public:
+	enum class SeatState : uint64_t
+	{
+		FREE = 0,
+		RESERVED = 1,
+		HELD = 2		// Temporarily held during booking; never persisted
+	};
+	
+private:
+	static constexpr int SEATS_PER_WORD = 32;
+	
+	string aircraftType;
+	const SeatLayout* layout;
+	int rows;
+	int seatCount;
+	int wordCount;
+	unique_ptr<std::atomic<uint64_t>[]> words;
+	std::atomic<int> reservedCount;
+	std::atomic<int> heldCount;
+	vector<int> rowCabins;							// Cabin index per row
+	int cabinCount;
+	unique_ptr<std::atomic<int>[]> cabinReserved;	// Reserved seats per cabin (fare bucket counters)
+	std::mutex persistMutex;	// Serializes snapshot + journal writes only
+	
+	// Helper methods
+	bool transition(int seatIndex, SeatState from, SeatState to) noexcept;
+	SeatBitset collect(SeatState state, bool invert = false) const;	// invert: every seat not in `state`
+	
+public:
+	// Constructor - seeds the atomic words and cabin counters from the persisted occupancy.
+	// rowCabins maps each row to its cabin; empty means a single cabin.
+	SeatInventory(const string& aircraftType, const SeatLayout& layout, int rows, const SeatBitset& occupancy,
+	              const vector<int>& rowCabins = {});
+	
+	// Getters
+	string getAircraftType() const noexcept;
+	int getSeatCount() const noexcept;
+	int getReservedCount() const noexcept;
+	int getHeldCount() const noexcept;
+	const SeatLayout& getLayout() const noexcept;
+	int getRows() const noexcept;
+	int getCabinCount() const noexcept;
+	int getCabinReservedCount(int cabinIndex) const noexcept;
+	const vector<int>& getRowCabins() const noexcept;
+	
+	// Resolves a "12C" style seat number to its seat index (-1 if invalid for this aircraft)
+	int getSeatIndex(const string& seatNumber) const;
+	
+	// Atomic seat operations
+	bool tryReserve(int seatIndex) noexcept;	// Returns false if invalid or already reserved
+	bool release(int seatIndex) noexcept;		// Returns false if invalid or not reserved
+	bool isReserved(int seatIndex) const noexcept;
+	
+	// Seat holds: FREE -> HELD, then HELD -> RESERVED on commit or HELD -> FREE on expiry
+	bool tryHold(int seatIndex) noexcept;
+	bool commitHold(int seatIndex) noexcept;
+	bool releaseHold(int seatIndex) noexcept;
+	bool isHeld(int seatIndex) const noexcept;
+	SeatState getState(int seatIndex) const noexcept;
+	
+	// Point-in-time copies for persistence (reserved only) and display
+	SeatBitset snapshot() const;
+	SeatBitset heldSnapshot() const;
+	SeatBitset occupiedSnapshot() const;	// Reserved or held
+	std::mutex& getPersistMutex() noexcept;
+	
+	~SeatInventory() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	SeatInventory(const SeatInventory&) = delete;
+	SeatInventory(SeatInventory&&) = delete;
+	SeatInventory& operator=(const SeatInventory&) = delete;
+	SeatInventory& operator=(SeatInventory&&) = delete;
+};
+
+#endif // SEATINVENTORY_HPP
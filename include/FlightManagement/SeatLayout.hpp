@@ -0,0 +1,108 @@
+#ifndef SEATLAYOUT_HPP
+#define SEATLAYOUT_HPP
+
+#include <string>
+
+using std::string;
+
+static constexpr int MAX_LAYOUT_SECTIONS = 8;
+static constexpr int MAX_SEATS_PER_ROW = 26;
+
+// ==================== SeatLayout Descriptor ====================
+
+// Parsed form of a seat layout string such as "3-4-3".
+// Seat letters run from 'A', skipping one letter at each aisle (e.g. 3-3 -> ABC EFG).
+struct SeatLayout
+{
+	int sectionCount = 0;
+	int sections[MAX_LAYOUT_SECTIONS] = {};
+	int seatsPerRow = 0;
+	char letters[MAX_SEATS_PER_ROW] = {};        // Seat ordinal -> letter
+	int ordinals[26] = {};                       // Letter - 'A' -> seat ordinal, -1 for aisle/unused
+	bool aisleAfter[MAX_SEATS_PER_ROW] = {};     // Seat ordinal is the last one before an aisle
+	
+	constexpr int ordinalOf(char letter) const noexcept
+	{
+		return (letter >= 'A' && letter <= 'Z') ? ordinals[letter - 'A'] : -1;
+	}
+	
+	constexpr bool isWindow(int ordinal) const noexcept
+	{
+		return ordinal == 0 || ordinal == seatsPerRow - 1;
+	}
+	
+	constexpr bool isAisle(int ordinal) const noexcept
+	{
+		return aisleAfter[ordinal] || (ordinal > 0 && aisleAfter[ordinal - 1]);
+	}
+	
+	// Returns the descriptor for a layout string: precomputed for standard layouts,
+	// parsed once and cached otherwise. Returns nullptr for invalid layouts.
+	static const SeatLayout* lookup(const string& layout);
+};
+
+// Builds a descriptor from section widths; sectionCount of 0 marks an invalid layout
+constexpr SeatLayout makeSeatLayout(const int* sections, int count)
+{
+	SeatLayout layout{};
+	
+	for (int i = 0; i < 26; ++i)
+	{
+		layout.ordinals[i] = -1;
+	}
+	
+	if (count <= 0 || count > MAX_LAYOUT_SECTIONS)
+	{
+		return layout;
+	}
+	
+	int letter = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		if (sections[i] <= 0 || layout.seatsPerRow + sections[i] > MAX_SEATS_PER_ROW ||
+		    letter + sections[i] > 26)
+		{
+			return SeatLayout{};
+		}
+		
+		layout.sections[i] = sections[i];
+		for (int j = 0; j < sections[i]; ++j)
+		{
+			layout.letters[layout.seatsPerRow] = static_cast<char>('A' + letter);
+			layout.ordinals[letter] = layout.seatsPerRow;
+			++layout.seatsPerRow;
+			++letter;
+		}
+		
+		// Skip a letter for aisle (except after last section)
+		if (i < count - 1)
+		{
+			layout.aisleAfter[layout.seatsPerRow - 1] = true;
+			++letter;
+		}
+	}
+	
+	layout.sectionCount = count;
+	return layout;
+}
+
+// ==================== Standard Layouts (compile-time) ====================
+
+template <int... Sections>
+struct StandardSeatLayout
+{
+	static constexpr int widths[] = {Sections...};
+	static constexpr SeatLayout value = makeSeatLayout(widths, sizeof...(Sections));
+};
+
+using Layout3_3 = StandardSeatLayout<3, 3>;
+using Layout2_2 = StandardSeatLayout<2, 2>;
+using Layout2_4_2 = StandardSeatLayout<2, 4, 2>;
+using Layout3_4_3 = StandardSeatLayout<3, 4, 3>;
+
+static_assert(Layout3_3::value.seatsPerRow == 6 && Layout3_3::value.letters[3] == 'E',
+              "3-3 layout skips D for the aisle");
+static_assert(Layout3_4_3::value.seatsPerRow == 10 && Layout3_4_3::value.ordinalOf('L') == 9,
+              "3-4-3 layout ends at L");
+
+#endif // SEATLAYOUT_HPP
@@ -5,6 +5,8 @@
 #include <vector>
 #include <exception>
 #include "json.hpp"
+#include "SeatBitset.hpp"
+#include "SeatLayout.hpp"
 #include "UserInterface.hpp"
 
 using nlohmann::json;
@@ -20,25 +22,36 @@ class SeatMap
 private:
 	string seatLayout;
 	int rows;
-	vector<string> reservedSeats;
+	const SeatLayout* layout;
+	SeatBitset reservedSeats;
+	SeatBitset heldSeats;
 	
 	// Helper methods
-	static vector<int> parseSeatLayout(const string& layout);
-	static vector<char> generateSeatLetters(const string& layout);
+	static const SeatLayout& resolveLayout(const string& seatLayout);
+	string renderSeatCell(int seatIndex) const;
 
 public:
 	// Constructors
 	SeatMap(const string& seatLayout, int rows);
 	SeatMap(const string& seatLayout, int rows, const vector<string>& reservedSeats);
+	SeatMap(const string& seatLayout, int rows, const SeatBitset& reservedSeats);
 	
 	// Static validation methods (used by Aircraft and Flight)
 	static bool validateSeatLayout(const string& layout);
 	
 	// Static seat generation (used by Aircraft for display purposes)
 	static vector<string> generateSeatMap(const string& seatLayout, int rows);
+	static vector<char> generateSeatLetters(const string& layout);
 	static int calculateSeatCount(const string& seatLayout, int rows);
 	static int getSeatsPerRow(const string& seatLayout);
 	
+	// Validates a seat number against a layout descriptor (no seat list generation)
+	static bool isValidSeatNumber(const string& seatNumber, const SeatLayout& layout, int rows);
+	
+	// Seat index encoding: (row - 1) * seatsPerRow + ordinal of the seat letter in the layout
+	static int seatToIndex(const string& seatNumber, const SeatLayout& layout, int rows);
+	static string indexToSeat(int seatIndex, const SeatLayout& layout);
+	
 	// Instance methods for seat validation
 	bool isValidSeat(const string& seatNumber) const;
 	vector<string> getAllSeats() const;
@@ -48,13 +61,21 @@ public:
 	bool releaseSeat(const string& seatNumber);
 	bool isSeatAvailable(const string& seatNumber) const;
 	vector<string> getReservedSeats() const;
+	const SeatBitset& getReservedSeatBits() const noexcept;
 	int getAvailableSeatsCount() const;
+	
+	// Seats temporarily held by an in-progress booking (shown as [H], not available)
+	void setHeldSeats(const SeatBitset& heldSeats);
 	int getTotalSeatsCount() const;
 	
 	// Display data generation methods
 	void getSeatMapDisplayData(vector<string>& rowLabels, 
 	                           vector<vector<string>>& gridData) const;
 	
+	// Replaces the occupancy and re-renders only the cells whose state changed
+	void applyOccupancy(const SeatBitset& reservedSeats, const SeatBitset& heldSeats,
+	                    vector<vector<string>>& gridData);
+	
 	vector<string> getSeatMapHeader(const string& flightNumber, const string& origin,
 	                                const string& destination, const string& aircraftType) const;
 	
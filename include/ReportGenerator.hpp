@@ -34,10 +34,13 @@ private:
 	void generateCrewSummaryReport();
 	void generateMaintenanceSummaryReport();
 	void generateUsersReport();
+	void verifyReservationCounters();
+	void replayReservationHistory();
 	
 	// Helper methods
 	void exportToFile(const string& reportName, const string& content);
 	string getCurrentDateTime() const;
+	static string formatHours(double hours);
 	void addReportHeader(std::ostringstream& oss, const string& title) const;
 	void displayAndLogSection(const string& title, const vector<string>& headers, 
 	                          const vector<vector<string>>& rows, std::ostringstream& reportContent);
@@ -0,0 +1,118 @@
+#ifndef CAPACITYMANAGER_HPP
+#define CAPACITYMANAGER_HPP
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <unordered_map>
+#include <unordered_set>
+#include "Flight.hpp"
+#include "Database.hpp"
+
+using std::string;
+using std::shared_ptr;
+using std::unique_ptr;
+
+static constexpr double MAX_OVERBOOKING_RATE = 0.10;	// Never sell more than 110% of physical seats
+static constexpr int MIN_NO_SHOW_SAMPLE = 20;			// Bookings needed before a no-show rate is trusted
+static constexpr int NO_SHOW_REFRESH_MINUTES = 15;
+static constexpr const char* UNASSIGNED_SEAT = "TBA";	// Seat of an overbooked reservation until check-in
+
+// ==================== No-Show Statistics ====================
+
+struct NoShowStats
+{
+	int bookings = 0;	// Non-canceled reservations on departed flights
+	int noShows = 0;	// Of those, never checked in
+	
+	double getRate() const noexcept;
+};
+
+using UnseatedKey = std::pair<string, string>;	// (bookingDate, reservationId)
+
+// Booking order: booking date, then reservation number ("RES_9" before "RES_10" in the same minute)
+struct UnseatedOrder
+{
+	bool operator()(const UnseatedKey& a, const UnseatedKey& b) const noexcept;
+};
+
+// ==================== CapacityManager ====================
+
+// Controlled overbooking. Authorized capacity per flight is derived from the historical
+// no-show rate of its route (falling back to the network-wide rate) and cached, so the
+// booking path checks it in O(1). FlightManager reports each departure, which folds that
+// one flight's reservations into the no-show model; the aggregates are persisted in the
+// "NoShowModel" entity with one journal record per flight. A recurring job re-derives the
+// cached capacities from the current model.
+class CapacityManager
+{
+private:
+	struct FlightCapacity
+	{
+		string routeKey;
+		int physicalSeats;
+		int authorizedSeats;
+		int unseatedBookings;	// Confirmed reservations holding UNASSIGNED_SEAT
+		std::set<UnseatedKey, UnseatedOrder> unseatedQueue;	// Saved ones among them, earliest booking first
+	};
+	
+	static CapacityManager* instance;
+	
+	unique_ptr<Database> db;
+	std::unordered_map<string, NoShowStats> routeStats;
+	NoShowStats networkStats;
+	std::unordered_set<string> countedFlights;	// Departed flights already folded into the model
+	std::unordered_map<string, FlightCapacity> flightCapacities;
+	bool modelLoaded;
+	std::mutex mutex;
+	
+	// Private constructor for singleton
+	CapacityManager();
+	
+	// Helper methods (caller holds mutex)
+	FlightCapacity& getFlightCapacity(const string& flightNumber);
+	int computeAuthorizedSeats(const string& routeKey, int physicalSeats) const;
+	double getRouteNoShowRate(const string& routeKey) const;
+	void loadModelLocked();		// Persisted aggregates; a one-time backfill if there are none yet
+	void foldFlightLocked(const shared_ptr<Flight>& flight);
+	void refreshCapacitiesLocked();
+	
+	static json statsToJson(const NoShowStats& stats);
+	static NoShowStats statsFromJson(const json& data);
+	
+	static string getRouteKey(const shared_ptr<Flight>& flight);
+	
+public:
+	// Singleton accessor
+	static CapacityManager* getInstance();
+	
+	// Booking path
+	int getAuthorizedCapacity(const string& flightNumber);
+	double getNoShowRate(const string& flightNumber);
+	bool tryAuthorizeOverbooking(const string& flightNumber);
+	void releaseOverbooking(const string& flightNumber);
+	
+	// Saved overbooked reservations, in booking order (from ReservationManager's save path)
+	void trackUnseated(const string& flightNumber, const UnseatedKey& key, bool unseated);
+	bool getFirstUnseated(const string& flightNumber, UnseatedKey& key);
+	
+	// Departure event (from FlightManager): counts the flight's no-shows once, however often reported
+	void recordDeparture(const shared_ptr<Flight>& flight);
+	static bool hasDeparted(const string& status);
+	
+	// Capacity maintenance (registered with JobScheduler)
+	void refreshNoShowModel();
+	
+	// Destructor
+	~CapacityManager() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	CapacityManager(const CapacityManager&) = delete;
+	CapacityManager(CapacityManager&&) = delete;
+	CapacityManager& operator=(const CapacityManager&) = delete;
+	CapacityManager& operator=(CapacityManager&&) = delete;
+};
+
+#endif // CAPACITYMANAGER_HPP
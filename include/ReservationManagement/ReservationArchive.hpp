@@ -0,0 +1,78 @@
+#ifndef RESERVATIONARCHIVE_HPP
+#define RESERVATIONARCHIVE_HPP
+
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "json.hpp"
+#include "Database.hpp"
+
+using nlohmann::json;
+using std::string;
+using std::vector;
+using std::unique_ptr;
+
+static constexpr int ARCHIVE_INTERVAL_HOURS = 6;
+static constexpr size_t ARCHIVE_CACHED_PARTITIONS = 4;	// Cold months kept in memory after a lookup
+static constexpr int ARCHIVE_GRACE_DAYS = 7;				// A month is sealed this long after it ends
+static constexpr const char* ARCHIVE_LATE_SUFFIX = "-late";	// Follow-up partition for flights closed after sealing
+
+// ==================== ReservationArchive Class ====================
+
+// Cold storage for reservations of finished flights, partitioned by departure month. Each
+// month is one CBOR file under "Databases/{entityName}/" that is only ever replaced whole, so
+// a partition nobody archives into is never rewritten. A small catalog records which
+// passengers, agents and flights each month holds; lookups load only the matching months,
+// and a few recently used partitions stay cached.
+class ReservationArchive
+{
+private:
+	string directory;
+	unique_ptr<Database> catalog;	// month -> {count, passengers, agents, flights}
+	std::unordered_multimap<string, string> monthsByPassenger;
+	std::unordered_multimap<string, string> monthsByAgent;
+	std::unordered_multimap<string, string> monthsByFlight;
+	size_t archivedCount;
+	std::list<std::pair<string, json>> cache;	// Most recently used first
+	std::mutex mutex;
+	
+	// Helper methods (caller holds mutex)
+	const json& loadPartition(const string& month);
+	void writePartition(const string& month, const json& reservations);
+	void indexMonth(const string& month, const json& entry);
+	vector<json> find(const std::unordered_multimap<string, string>& months, const string& key, const string& field);
+	string getPartitionPath(const string& month) const;
+	
+public:
+	// Constructor - loads the catalog only; partitions are read on demand
+	explicit ReservationArchive(const string& entityName);
+	
+	// Adds reservations (ID -> record) to a month's partition; callers archive a month once it is sealed,
+	// so the load-merge-rewrite here normally happens once per partition
+	void archive(const string& month, const json& reservations);
+	
+	// Cold lookups (records as stored)
+	vector<json> findByPassenger(const string& passengerUsername);
+	vector<json> findByAgent(const string& agentUsername);
+	vector<json> findByFlight(const string& flightNumber);
+	vector<json> loadAll();
+	
+	size_t getArchivedCount();
+	bool hasPartition(const string& partition);
+	
+	// "YYYY-MM" partition of a "YYYY-MM-DD HH:MM" departure time
+	static string getPartitionKey(const string& departureDateTime);
+	
+	~ReservationArchive() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	ReservationArchive(const ReservationArchive&) = delete;
+	ReservationArchive(ReservationArchive&&) = delete;
+	ReservationArchive& operator=(const ReservationArchive&) = delete;
+	ReservationArchive& operator=(ReservationArchive&&) = delete;
+};
+
+#endif // RESERVATIONARCHIVE_HPP
@@ -0,0 +1,116 @@
+#ifndef RESERVATIONEVENTLOG_HPP
+#define RESERVATIONEVENTLOG_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include "json.hpp"
+#include "Database.hpp"
+
+using nlohmann::json;
+using std::string;
+using std::vector;
+using std::unique_ptr;
+
+static constexpr int RESERVATION_SNAPSHOT_MINUTES = 30;
+static constexpr size_t REPLAY_MIN_EVENTS_PER_THREAD = 10000;	// Smaller logs replay on fewer threads
+
+// ==================== Reservation Events ====================
+
+enum class ReservationEventType
+{
+	CREATED,
+	SEAT_CHANGED,
+	CHECKED_IN,
+	CANCELED,
+	COMPLETED,
+	UPDATED,	// Any other field change
+	ARCHIVED,	// Moved to cold storage; replay drops it from the hot projection
+	ABORTED		// The table write after a logged event failed; `changes` restores the prior fields (null: never created)
+};
+
+// One state change of one reservation. `changes` holds only the fields that changed (the
+// whole record for CREATED), so applying a reservation's events in order with merge-patch
+// rebuilds its current state.
+struct ReservationEvent
+{
+	uint64_t sequence;
+	ReservationEventType type;
+	string reservationId;
+	string flightNumber;	// Replay partition key; a reservation never changes flight
+	string recordedAt;
+	json changes;
+};
+
+// Where the log stood at some instant; a snapshot stores it so replay can seek past it
+struct EventLogPosition
+{
+	uint64_t sequence = 0;	// Last sequence number written
+	uint64_t offset = 0;	// Byte offset just after that event
+};
+
+struct ReplayResult
+{
+	json reservations;			// Reservation ID -> rebuilt record
+	size_t eventsApplied = 0;
+	size_t malformedEvents = 0;	// Unparseable lines, skipped
+	size_t threadsUsed = 0;
+};
+
+// ==================== ReservationEventLog Class ====================
+
+// Append-only history of reservation changes in "Databases/{entityName}.log" (one JSON event
+// per line), with periodic snapshots of the projected state in "{entityName}Snapshot". Replay
+// starts from the latest snapshot, parses the tail in parallel and applies it with one thread
+// per flight partition, so a flight's events stay in order without any locking.
+class ReservationEventLog
+{
+private:
+	string logPath;
+	unique_ptr<Database> snapshotDb;
+	EventLogPosition position;
+	EventLogPosition snapshotPosition;
+	std::mutex mutex;
+	
+	// Helper methods
+	void recoverPosition();
+	static json eventToJson(const ReservationEvent& event);
+	static bool eventFromJson(const char* line, size_t length, ReservationEvent& event);
+	
+public:
+	// Constructor - opens or creates the log and locates its end from the latest snapshot
+	explicit ReservationEventLog(const string& entityName);
+	
+	// Classifies the change from `before` (null if the reservation is new) to `after`; returns
+	// false if nothing changed
+	static bool describeChange(const json& before, const json& after, ReservationEvent& event);
+	
+	// The compensating event for a change whose table write failed after it was appended;
+	// a null `after` undoes a removal and restores all of `before`
+	static bool describeAbort(const json& before, const json& after, ReservationEvent& event);
+	
+	// Assigns sequence numbers and appends the events with one write
+	void append(vector<ReservationEvent>& events);
+	
+	// Snapshots pair a projection with the position it reflects. Take the position before reading
+	// the projection: events written in between are replayed again, which merge-patch tolerates.
+	EventLogPosition getPosition();
+	bool hasSnapshot();
+	bool hasEventsSinceSnapshot();
+	void writeSnapshot(const EventLogPosition& at, const json& reservations);
+	
+	// Rebuilds every reservation from the latest snapshot plus the events after it
+	ReplayResult replay();
+	
+	~ReservationEventLog() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	ReservationEventLog(const ReservationEventLog&) = delete;
+	ReservationEventLog(ReservationEventLog&&) = delete;
+	ReservationEventLog& operator=(const ReservationEventLog&) = delete;
+	ReservationEventLog& operator=(ReservationEventLog&&) = delete;
+};
+
+#endif // RESERVATIONEVENTLOG_HPP
@@ -4,7 +4,12 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include "Reservation.hpp"
+#include "IdempotencyStore.hpp"
+#include "ReservationEventLog.hpp"
+#include "ReservationArchive.hpp"
 #include "User.hpp"
 #include "Database.hpp"
 #include "UserInterface.hpp"
@@ -14,6 +19,53 @@ using std::vector;
 using std::unique_ptr;
 using std::shared_ptr;
 
+static constexpr int IDEMPOTENCY_KEY_TTL_HOURS = 24;		// A retry must arrive within this window
+static constexpr size_t IDEMPOTENCY_KEY_CAPACITY = 10000;
+static constexpr size_t BOARDING_PASSES_PER_THREAD = 64;	// Smaller flights render on fewer threads
+
+// ==================== Counter Verification ====================
+
+// A flight whose maintained CONFIRMED counter disagrees with a full recount
+struct ReservationCountMismatch
+{
+	string flightNumber;
+	int counted;	// Maintained counter
+	int actual;		// From scanning every reservation
+};
+
+// ==================== Batch Booking ====================
+
+// One booking in a batch; an empty seat number lets the system assign one
+struct BookingRequest
+{
+	string passengerUsername;
+	string flightNumber;
+	string seatNumber;
+	string idempotencyKey;	// Optional client token; a retry with the same key returns the first result
+	string cabin;			// Optional cabin for an assigned seat; empty seats the passenger in the lead-in cabin
+};
+
+struct BookingResult
+{
+	bool success;
+	string reservationId;
+	string seatNumber;
+	double cost;
+	string error;
+};
+
+// ==================== Bulk Check-In ====================
+
+struct BulkCheckInResult
+{
+	int checkedIn = 0;			// Newly checked in by this run
+	int alreadyCheckedIn = 0;
+	int seatsAssigned = 0;		// Overbooked passengers given a seat
+	int notSeated = 0;			// Overbooked passengers still without a seat; not checked in
+	int boardingPasses = 0;
+	string boardingPassFile;
+};
+
 // ==================== ReservationManager ====================
 
 class ReservationManager
@@ -21,8 +73,30 @@ class ReservationManager
 private:
 	static ReservationManager* instance;
 	
+	// Secondary indexes (key -> reservation IDs), built once from the database and kept in
+	// sync on save, so per-passenger/flight/agent lookups touch only matching reservations
+	struct IndexedKeys
+	{
+		string passengerUsername;
+		string flightNumber;
+		string bookedByAgent;
+		bool active;	// CONFIRMED; counted in activeCounts
+	};
+	
 	unique_ptr<Database> db;
 	UserInterface* ui;
+	unique_ptr<IdempotencyStore> idempotencyKeys;	// Successful bookings by agent-scoped client key
+	unique_ptr<ReservationEventLog> eventLog;		// Every saved change, in order
+	unique_ptr<ReservationArchive> archive;			// Reservations of arrived flights, by departure month
+	unique_ptr<Database> sequenceDb;				// Next reservation number; never reissued
+	std::mutex sequenceMutex;
+	std::unordered_multimap<string, string> passengerIndex;
+	std::unordered_multimap<string, string> flightIndex;
+	std::unordered_multimap<string, string> agentIndex;
+	std::unordered_map<string, IndexedKeys> indexedKeys;	// reservation ID -> keys it is indexed under
+	std::unordered_map<string, int> activeCounts;			// flight -> CONFIRMED reservations
+	bool indexesBuilt;
+	std::mutex indexMutex;
 	
 	// Private constructor for singleton
 	ReservationManager();
@@ -30,23 +104,49 @@ private:
 	// Database operations
 	shared_ptr<Reservation> loadReservationFromDatabase(const string& reservationId);
 	void saveReservationToDatabase(const shared_ptr<Reservation>& reservation);
+	void saveReservationsToDatabase(const vector<shared_ptr<Reservation>>& reservations);	// One file write
+	void recordEvents(const vector<std::pair<json, json>>& changes);	// (before, after); before is null when new
+	void abortEvents(const vector<std::pair<json, json>>& changes);	// Compensates recordEvents after a failed table write
+	static void trackUnseated(const vector<std::pair<json, json>>& changes);	// Keeps CapacityManager's TBA queue current
+	
+	// Offered when a flight is full and cannot be overbooked
+	void offerWaitlist(const string& passengerUsername, const string& flightNumber, const string& agentUsername);
 	
 	// Shared helper for modify and cancel
 	void updateOrCancel(bool isModify);
+	void releaseReservedSeat(const string& flightNumber, const string& seatNumber);	// Seat or overbooking allowance
 	
 	// Query helpers
-	vector<shared_ptr<Reservation>> loadAllReservations();
+	vector<shared_ptr<Reservation>> loadAllReservations();	// Hot table only
+	void appendArchived(vector<shared_ptr<Reservation>>& results, const vector<json>& archived);
+	vector<shared_ptr<Reservation>> loadIndexedReservations(const std::unordered_multimap<string, string>& index,
+	                                                        const string& key);
+	
+	// Index maintenance (caller holds indexMutex)
+	void buildIndexes();
+	void clearIndexes();
+	void indexReservation(const string& reservationId, const IndexedKeys& keys);
+	void unindexReservation(const string& reservationId);
+	static void eraseIndexEntry(std::unordered_multimap<string, string>& index, const string& key,
+	                            const string& reservationId);
 	
 	// JSON serialization
 	json reservationToJson(const shared_ptr<Reservation>& reservation);
 	shared_ptr<Reservation> reservationFromJson(const json& data);
+	static json bookingResultToJson(const BookingResult& result);
+	static BookingResult bookingResultFromJson(const json& data);
+	static string scopeIdempotencyKey(const string& agentUsername, const string& key);
 	
 	// Display helpers
 	void displayReservationsTable(const vector<shared_ptr<Reservation>>& reservations);
 	void displayBoardingPass(const shared_ptr<Reservation>& reservation);
+	static string renderBoardingPass(const shared_ptr<Reservation>& reservation, const string& passengerName,
+	                                 const string& gate, const string& boardingTime);
 	
 	// Utility
 	string getCurrentDateTime() const;
+	int getNextReservationNumber(int count = 1);	// Reserves `count` consecutive numbers, persisted before use
+	void seedReservationSequence();					// First run: continues after every number already issued
 	
 public:
 	// Singleton accessor
@@ -54,21 +154,63 @@ public:
 	
 	// Booking operations (BOOKING AGENT)
 	void createReservation(const string& agentUsername);
+	void createGroupReservation(const string& agentUsername);
+	void importReservations(const string& agentUsername);
+	
+	// Programmatic batch booking (charters, corporate loads): passengers are validated in bulk,
+	// seats are reserved with one journal record per flight and all reservations are written once
+	vector<BookingResult> createReservations(const vector<BookingRequest>& requests, const string& agentUsername);
+	
+	// Books a seat the caller already holds for a passenger leaving the waitlist, at the fare they
+	// were quoted when joining; returns the ID
+	string createPromotedReservation(const string& passengerUsername, const string& flightNumber,
+	                                 const string& seatNumber, const string& agentUsername, double totalCost);
+	void cancelPromotedReservation(const string& reservationId);	// Undoes a promotion; the caller keeps the seat
+	bool hasConfirmedReservation(const string& passengerUsername, const string& flightNumber);
+	
+	// Hands a released seat to the earliest-booked CONFIRMED reservation still holding
+	// UNASSIGNED_SEAT; false when the flight has none. Confirmed passengers outrank the waitlist.
+	bool seatOverbookedPassenger(const string& flightNumber, const string& seatNumber);
 	void modifyReservation(const string& agentUsername);
 	void cancelReservation(const string& agentUsername);
 	
-	// Query operations (role-based)
+	// Query operations (role-based); lookups include archived reservations
 	void viewReservations(const string& username, UserRole role);
 	vector<shared_ptr<Reservation>> getReservationsByPassenger(const string& passengerUsername);
 	vector<shared_ptr<Reservation>> getReservationsByFlight(const string& flightNumber);
+	vector<shared_ptr<Reservation>> getReservationsByAgent(const string& agentUsername);
 	vector<shared_ptr<Reservation>> getAllReservations();
 	
 	// Check-in operations (PASSENGER)
 	void checkIn(const string& passengerUsername);
 	void viewBoardingPass(const string& passengerUsername);
 	
+	// Gate check-in (BOOKING AGENT): every CONFIRMED reservation on the flight is checked in with
+	// one batched write, and all boarding passes are rendered in parallel into a single file
+	void checkInFlight();
+	BulkCheckInResult bulkCheckIn(const string& flightNumber);
+	
 	// Cascade & utility
 	static bool hasActiveReservations(const string& flightNumber);
+	int getActiveReservationCount(const string& flightNumber);
+	
+	// Offline consistency check of the active counters against a full scan; rebuild repairs them
+	vector<ReservationCountMismatch> verifyActiveReservationCounts();
+	void rebuildIndexes();
+	
+	// Event history: snapshots are taken by a recurring job; replay rebuilds state from the log
+	void snapshotReservations();
+	ReplayResult replayEventLog();
+	vector<string> findDivergentReservations(const json& replayed);	// IDs whose stored record differs
+	void restoreReservations(const json& replayed);
+	
+	// Flight completion: CONFIRMED reservations of the flights become COMPLETED with one write
+	size_t completeReservations(const vector<string>& flightNumbers);
+	
+	// Moves reservations of completed and canceled flights to the archive once their departure month
+	// is sealed, ARCHIVE_GRACE_DAYS after it ends. Each month's partition is written once; flights that
+	// close later go to the month's small follow-up partition (registered with JobScheduler)
+	size_t archiveCompletedFlights();
 	
 	// Destructor
 	~ReservationManager() noexcept;
@@ -0,0 +1,116 @@
+#ifndef WAITLISTMANAGER_HPP
+#define WAITLISTMANAGER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <map>
+#include <cstdint>
+#include <unordered_map>
+#include "Database.hpp"
+#include "UserInterface.hpp"
+
+using std::string;
+using std::vector;
+using std::unique_ptr;
+
+// ==================== Waitlist Entry ====================
+
+enum class WaitlistPriority
+{
+	STANDARD,
+	FREQUENT_FLYER,
+	PREMIUM
+};
+
+struct WaitlistEntry
+{
+	uint64_t sequence;		// Per-flight arrival order
+	string passengerUsername;
+	string agentUsername;	// Agent who waitlisted the passenger; books the promotion
+	WaitlistPriority priority;
+	string requestedAt;
+	int cabin;				// Cabin quoted at join; only its seats are offered. -1: the lead-in cabin (older entries)
+	double quotedFare;		// Fare quoted at join and charged on promotion; 0 if not recorded
+};
+
+// Higher tiers first, then first come first served
+struct WaitlistOrder
+{
+	bool operator()(const WaitlistEntry& a, const WaitlistEntry& b) const noexcept;
+};
+
+// ==================== WaitlistManager ====================
+
+// Per-flight priority waitlists persisted in the "Waitlists" entity. Each flight keeps one
+// queue per quoted cabin, an ordered set, so joining and promoting the head are O(log n);
+// every change is a single journal record. A released seat goes straight to the head of its
+// cabin's queue.
+class WaitlistManager
+{
+private:
+	struct CabinWaitlist
+	{
+		std::set<WaitlistEntry, WaitlistOrder> queue;
+		size_t tierCounts[3] = {0, 0, 0};	// Entries per WaitlistPriority, for O(1) join positions
+	};
+	
+	struct FlightWaitlist
+	{
+		std::map<int, CabinWaitlist> cabins;	// Quoted cabin -> queue
+		std::unordered_map<string, std::set<WaitlistEntry, WaitlistOrder>::iterator> byPassenger;
+		uint64_t nextSequence = 1;
+	};
+	
+	static WaitlistManager* instance;
+	
+	unique_ptr<Database> db;
+	UserInterface* ui;
+	std::unordered_map<string, FlightWaitlist> waitlists;
+	std::mutex mutex;
+	
+	// Private constructor for singleton
+	WaitlistManager();
+	
+	// Helper methods (caller holds mutex)
+	void loadWaitlists();
+	void persistEntry(const string& flightNumber, const WaitlistEntry& entry);
+	void persistRemoval(const string& flightNumber, uint64_t sequence);
+	void insertEntry(FlightWaitlist& waitlist, const WaitlistEntry& entry);
+	void eraseEntry(FlightWaitlist& waitlist, const string& passengerUsername);
+	void restoreEntry(const string& flightNumber, const WaitlistEntry& entry);	// Takes the mutex itself
+	
+	static json entryToJson(const WaitlistEntry& entry);
+	
+public:
+	// Singleton accessor
+	static WaitlistManager* getInstance();
+	
+	// Queue operations; join returns the passenger's position in the cabin's queue
+	size_t join(const string& flightNumber, const string& passengerUsername, const string& agentUsername,
+	          WaitlistPriority priority, int cabin, double quotedFare);
+	bool isWaitlisted(const string& flightNumber, const string& passengerUsername);
+	size_t getWaitlistLength(const string& flightNumber, int cabin);
+	
+	// Gives a just-released seat to the head of its cabin's waitlist, at the fare that passenger was
+	// quoted, while the flight is still Scheduled or Delayed. A seat in a cabin nobody was quoted for
+	// goes back to the pool. Seat, reservation and queue change together: if the reservation
+	// cannot be saved, or the queue change cannot be recorded and the reservation is canceled
+	// again, the seat is released and the passenger keeps their place.
+	bool promoteNext(const string& flightNumber, const string& seatNumber);
+	
+	static string priorityToString(WaitlistPriority priority);
+	
+	// Destructor
+	~WaitlistManager() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	WaitlistManager(const WaitlistManager&) = delete;
+	WaitlistManager(WaitlistManager&&) = delete;
+	WaitlistManager& operator=(const WaitlistManager&) = delete;
+	WaitlistManager& operator=(WaitlistManager&&) = delete;
+};
+
+#endif // WAITLISTMANAGER_HPP
@@ -77,6 +77,7 @@ public:
 	vector<string> getAllUsernames();
 	vector<shared_ptr<User>> getAllUsers();
 	bool userExists(const string& username);
+	vector<bool> usersExist(const vector<string>& usernames);	// Bulk check under one database lock
 	
 	// Destructor
 	~UsersManager() noexcept;
@@ -2,24 +2,33 @@
 #define DATABASE_HPP
 
 #include <string>
+#include <vector>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include "json.hpp"
 
 using nlohmann::json;
 using std::string;
 
+static constexpr size_t JOURNAL_COMPACTION_RECORDS = 500;	// Journal records replayed on load before the file is rewritten
+
 // ==================== Database Class ====================
 
 class Database
 {
 private:
 	string filePath;
+	string journalPath;
 	std::unique_ptr<json> cachedData;  // In-memory cache
+	mutable size_t journalRecords = 0;	// Appended since the last full write
+	mutable std::recursive_mutex mutex;
 	
 	// Helper methods
 	void loadFromFile();
 	void writeToFile() const;
+	void replayJournal();
+	void compactJournal();	// Full write once the journal holds JOURNAL_COMPACTION_RECORDS records
 
 public:
 	// Constructor - takes entity name only (e.g., "Flight", "User", "Aircraft")
@@ -37,6 +46,18 @@ public:
 	bool entryExists(const string& entryKey) const;
 	void updateEntry(const string& entryKey, const json& updates);	// Bulk Updates
 	
+	// Batch operations: one lock for the whole batch and at most one file write
+	std::vector<bool> entriesExist(const std::vector<string>& entryKeys) const;
+	void upsertEntries(const json& entries);	// {entryKey: entryData, ...}; adds or replaces each entry
+	void deleteEntries(const std::vector<string>& entryKeys);	// Missing keys are ignored
+	
+	// Journaled update: applies updates in memory and appends them to "Databases/{entityName}.journal"
+	// instead of rewriting the whole file. The journal is replayed on load and cleared on the next full write,
+	// which happens after JOURNAL_COMPACTION_RECORDS appends if no other write comes first.
+	void journalEntry(const string& entryKey, const json& updates);
+	void journalEntries(const json& updatesByKey);	// {entryKey: updates, ...} as one record, replayed whole or not at all
+	void journalUpserts(const json& entries, const std::vector<string>& deletedKeys);	// Whole entries added/replaced and removed, as one record
+	
 	// Attribute operations
 	auto getAttribute(const string& entryKey, const string& attributeKey) const;
 	void setAttribute(const string& entryKey, const string& attributeKey, const json& value);
@@ -0,0 +1,70 @@
+#ifndef IDEMPOTENCYSTORE_HPP
+#define IDEMPOTENCYSTORE_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <unordered_map>
+#include "json.hpp"
+#include "Database.hpp"
+
+using nlohmann::json;
+using std::string;
+using std::vector;
+using std::unique_ptr;
+
+// ==================== IdempotencyStore Class ====================
+
+// Bounded, persisted dedup table mapping client request keys to the result of the first
+// request. Lookups are O(1) through a hash map; keys expire in insertion order (a FIFO of
+// timestamps), and the oldest keys are evicted early once capacity is reached. Each write
+// journals only the keys it added or evicted; Database compacts the journal itself.
+class IdempotencyStore
+{
+private:
+	struct Record
+	{
+		json result;
+		int64_t createdAt;	// Seconds since epoch, so expiry survives restarts
+	};
+	
+	unique_ptr<Database> db;
+	std::chrono::seconds timeToLive;
+	size_t capacity;
+	std::unordered_map<string, Record> records;
+	std::deque<std::pair<int64_t, string>> insertionOrder;	// Oldest first
+	std::mutex mutex;
+	
+	// Helper methods (caller holds mutex)
+	void evict(int64_t now, vector<string>& removed);
+	void popOldest(vector<string>& removed);
+	void persist(const vector<string>& added, const vector<string>& removed);
+	static int64_t currentTime();
+	
+public:
+	// Constructor - loads "Databases/{entityName}.json" and drops expired keys
+	IdempotencyStore(const string& entityName, std::chrono::seconds timeToLive, size_t capacity);
+	
+	// Returns true and fills `result` if the key was seen and has not expired
+	bool lookup(const string& key, json& result);
+	
+	// Records results for new keys with one write; keys already present keep their first result
+	void record(const string& key, const json& result);
+	void recordAll(const vector<std::pair<string, json>>& results);
+	
+	size_t size();
+	
+	~IdempotencyStore() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	IdempotencyStore(const IdempotencyStore&) = delete;
+	IdempotencyStore(IdempotencyStore&&) = delete;
+	IdempotencyStore& operator=(const IdempotencyStore&) = delete;
+	IdempotencyStore& operator=(IdempotencyStore&&) = delete;
+};
+
+#endif // IDEMPOTENCYSTORE_HPP
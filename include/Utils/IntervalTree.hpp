@@ -0,0 +1,54 @@
+#ifndef INTERVALTREE_HPP
+#define INTERVALTREE_HPP
+
+#include <string>
+#include <vector>
+#include <tuple>
+#include <ctime>
+
+using std::string;
+using std::vector;
+
+// ==================== IntervalTree Class ====================
+
+// Half-open time intervals [start, end), one per key. The intervals sit in a single array sorted
+// by start that doubles as an implicit balanced tree: the middle of every range is that range's
+// root and stores the latest end in the range. An overlap query skips any range that ends before
+// the window and any right half that starts after it, so it runs in O(log n + k) for k matches.
+// Changes rebuild the array in O(n), which suits small, read-mostly schedules. Not thread-safe;
+// the owner serializes access.
+class IntervalTree
+{
+private:
+	struct Interval
+	{
+		std::time_t start;
+		std::time_t end;
+		string key;
+	};
+	
+	vector<Interval> intervals;		// Sorted by start
+	vector<std::time_t> maxEnd;		// Latest end within the range rooted at each index
+	
+	// Helper methods
+	std::time_t buildMaxEnd(size_t low, size_t high);
+	bool collectOverlapping(size_t low, size_t high, std::time_t start, std::time_t end,
+	                        vector<string>* matches) const;	// Stops at the first match when matches is null
+	
+public:
+	// Replaces any interval already stored for the key; empty intervals are not stored
+	void insert(const string& key, std::time_t start, std::time_t end);
+	bool erase(const string& key);
+	void assign(vector<std::tuple<string, std::time_t, std::time_t>> entries);	// Replaces everything; one O(n log n) build
+	
+	// Queries against the window [start, end)
+	bool overlaps(std::time_t start, std::time_t end) const;
+	vector<string> findOverlapping(std::time_t start, std::time_t end) const;	// In start order
+	
+	size_t size() const noexcept;
+	bool empty() const noexcept;
+	
+	~IntervalTree() noexcept = default;
+};
+
+#endif // INTERVALTREE_HPP
@@ -0,0 +1,59 @@
+#ifndef JOBSCHEDULER_HPP
+#define JOBSCHEDULER_HPP
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+using std::string;
+using std::vector;
+
+// ==================== JobScheduler Class ====================
+
+// Recurring maintenance jobs (model refreshes, sweeps). The system is menu-driven and
+// single-threaded, so jobs run cooperatively: menu loops call runDueJobs() between
+// screens, keeping the work off the booking path without racing the UI.
+class JobScheduler
+{
+private:
+	struct Job
+	{
+		string name;
+		std::chrono::seconds interval;
+		std::chrono::steady_clock::time_point nextRun;
+		std::function<void()> task;
+	};
+	
+	static JobScheduler* instance;
+	
+	vector<Job> jobs;
+	std::mutex mutex;
+	bool running;	// Guards against re-entry when a job drives a menu loop
+	
+	// Private constructor for singleton
+	JobScheduler();
+	
+public:
+	// Singleton accessor
+	static JobScheduler* getInstance();
+	
+	// Registers (or replaces) a recurring job; the first run is one interval from now
+	void scheduleRecurring(const string& name, std::chrono::seconds interval, std::function<void()> task);
+	void cancel(const string& name);
+	
+	// Runs every job whose time has come; job failures are contained
+	void runDueJobs();
+	
+	// Destructor
+	~JobScheduler() noexcept = default;
+	
+	// Delete copy and move constructors/assignments
+	JobScheduler(const JobScheduler&) = delete;
+	JobScheduler(JobScheduler&&) = delete;
+	JobScheduler& operator=(const JobScheduler&) = delete;
+	JobScheduler& operator=(JobScheduler&&) = delete;
+};
+
+#endif // JOBSCHEDULER_HPP
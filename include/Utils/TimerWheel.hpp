@@ -0,0 +1,54 @@
+#ifndef TIMERWHEEL_HPP
+#define TIMERWHEEL_HPP
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+using std::vector;
+
+// ==================== TimerWheel Class ====================
+
+// Hashed timing wheel: timers hash into a slot by expiry tick, so schedule and cancel are O(1)
+// and each tick only touches the timers in one slot. Advancing past a long idle period visits
+// every slot at most once. Not thread-safe; the owner serializes access.
+class TimerWheel
+{
+private:
+	struct Timer
+	{
+		uint64_t expiryTick;
+		size_t slot;
+		size_t position;	// Index within the slot, kept current for swap-remove
+	};
+	
+	std::chrono::milliseconds tickDuration;
+	vector<vector<uint64_t>> slots;
+	std::unordered_map<uint64_t, Timer> timers;
+	uint64_t currentTick;
+	std::chrono::steady_clock::time_point lastTickTime;
+	uint64_t nextTimerId;
+	
+	// Helper methods
+	void removeFromSlot(const Timer& timer);
+	
+public:
+	// Constructor
+	TimerWheel(std::chrono::milliseconds tickDuration, size_t slotCount);
+	
+	// Timer operations (timer ids start at 1; 0 is never issued)
+	uint64_t schedule(std::chrono::milliseconds delay);
+	bool cancel(uint64_t timerId);
+	bool isPending(uint64_t timerId) const;
+	
+	// Moves the wheel up to the given time and returns the ids of the timers that expired
+	vector<uint64_t> advance();
+	vector<uint64_t> advance(std::chrono::steady_clock::time_point now);
+	
+	size_t size() const noexcept;
+	
+	~TimerWheel() noexcept = default;
+};
+
+#endif // TIMERWHEEL_HPP
@@ -4,10 +4,10 @@
 
 Aircraft::Aircraft(const string& aircraftType, const string& manufacturer, const string& model,
                    int totalSeats, const string& seatLayout, int rows, int fleetCount,
-                   const string& status)
+                   const string& status, const vector<CabinClass>& cabins)
 	: aircraftType(aircraftType), manufacturer(manufacturer), model(model),
 	  totalSeats(totalSeats), seatLayout(seatLayout), rows(rows),
-	  fleetCount(fleetCount), status(status)
+	  fleetCount(fleetCount), status(status), cabins(cabins)
 {}
 
 // ==================== Getters ====================
@@ -52,6 +52,15 @@ string Aircraft::getStatus() const noexcept
 	return status;
 }
 
+vector<CabinClass> Aircraft::getCabins() const
+{
+	if (cabins.empty())
+	{
+		return {CabinClass{DEFAULT_CABIN_NAME, 1, rows}};
+	}
+	return cabins;
+}
+
 // ==================== Setters ====================
 
 void Aircraft::setManufacturer(const string& manufacturer) noexcept
@@ -77,6 +86,16 @@ void Aircraft::setSeatLayout(const string& seatLayout) noexcept
 void Aircraft::setRows(int rows) noexcept
 {
 	this->rows = rows;
+	
+	// Rows are added or removed at the back, so the rearmost cabins absorb the change
+	while (!cabins.empty() && cabins.back().firstRow > rows)
+	{
+		cabins.pop_back();
+	}
+	if (!cabins.empty())
+	{
+		cabins.back().lastRow = rows;
+	}
 }
 
 void Aircraft::setFleetCount(int fleetCount) noexcept
@@ -89,6 +108,11 @@ void Aircraft::setStatus(const string& status) noexcept
 	this->status = status;
 }
 
+void Aircraft::setCabins(const vector<CabinClass>& cabins)
+{
+	this->cabins = cabins;
+}
+
 // ==================== AircraftException Class ====================
 
 AircraftException::AircraftException(const string& message) : message(message) {}
@@ -55,6 +55,27 @@ bool AircraftValidator::isValidFleetCount(int fleetCount)
 	return fleetCount > 0;
 }
 
+bool AircraftValidator::isValidCabins(const vector<CabinClass>& cabins, int rows)
+{
+	// Cabins must cover rows 1..rows front to back without gaps, overlaps or duplicate names
+	int nextRow = 1;
+	for (size_t i = 0; i < cabins.size(); ++i)
+	{
+		const CabinClass& cabin = cabins[i];
+		if (!isValidManufacturer(cabin.name) || cabin.firstRow != nextRow || cabin.lastRow < cabin.firstRow)
+			return false;
+		
+		for (size_t j = 0; j < i; ++j)
+		{
+			if (cabins[j].name == cabin.name)
+				return false;
+		}
+		nextRow = cabin.lastRow + 1;
+	}
+	
+	return !cabins.empty() && nextRow == rows + 1;
+}
+
 // ==================== AircraftCreator ====================
 
 AircraftCreator::AircraftCreator()
@@ -75,10 +96,11 @@ shared_ptr<Aircraft> AircraftCreator::createNewAircraft()
 		int totalSeats = getValidSeatCount();
 		string seatLayout = getValidSeatLayout();
 		int rows = getValidRows();
+		vector<CabinClass> cabins = getValidCabins(rows);
 		int fleetCount = getValidFleetCount();
 		string status = "Available";
 		
-		return std::shared_ptr<Aircraft>(new Aircraft(aircraftType, manufacturer, model, totalSeats, seatLayout, rows, fleetCount, status));
+		return std::shared_ptr<Aircraft>(new Aircraft(aircraftType, manufacturer, model, totalSeats, seatLayout, rows, fleetCount, status, cabins));
 	}
 	catch (const std::exception& e)
 	{
@@ -228,6 +250,70 @@ int AircraftCreator::getValidFleetCount()
 	}
 }
 
+vector<CabinClass> AircraftCreator::getValidCabins(int rows)
+{
+	while (true)
+	{
+		try
+		{
+			string input = ui->getString("Enter Cabins (e.g., Business:1-5,Economy:6-30), blank for a single Economy cabin: ");
+			
+			if (input.find_first_not_of(" \t") == string::npos)
+				return {};
+			
+			vector<CabinClass> cabins = parseCabins(input);
+			if (AircraftValidator::isValidCabins(cabins, rows))
+				return cabins;
+			
+			throw AircraftException("Invalid cabins. Row ranges must cover rows 1-" + std::to_string(rows) +
+			                        " in order, without gaps or duplicate names.");
+		}
+		catch (const std::exception& e)
+		{
+			ui->printError(string(e.what()));
+		}
+	}
+}
+
+vector<CabinClass> AircraftCreator::parseCabins(const string& input)
+{
+	vector<CabinClass> cabins;
+	size_t start = 0;
+	
+	while (start <= input.length())
+	{
+		size_t end = input.find(',', start);
+		if (end == string::npos)
+			end = input.length();
+		
+		string token = input.substr(start, end - start);
+		size_t colon = token.find(':');
+		size_t dash = token.find('-', colon == string::npos ? 0 : colon);
+		if (colon == string::npos || dash == string::npos)
+		{
+			throw AircraftException("Invalid cabin \"" + token + "\". Expected Name:FirstRow-LastRow.");
+		}
+		
+		string name = token.substr(0, colon);
+		name.erase(0, name.find_first_not_of(' '));
+		name.erase(name.find_last_not_of(' ') + 1);
+		
+		try
+		{
+			cabins.push_back(CabinClass{name, std::stoi(token.substr(colon + 1, dash - colon - 1)),
+			                            std::stoi(token.substr(dash + 1))});
+		}
+		catch (const std::logic_error& e)
+		{
+			throw AircraftException("Invalid row range in cabin \"" + token + "\".");
+		}
+		
+		start = end + 1;
+	}
+	
+	return cabins;
+}
+
 // ==================== JSON Serialization ====================
 
 json AircraftCreator::toJson(const shared_ptr<Aircraft>& aircraft)
@@ -246,6 +332,12 @@ json AircraftCreator::toJson(const shared_ptr<Aircraft>& aircraft)
 	aircraftData["fleetCount"] = aircraft->getFleetCount();
 	aircraftData["status"] = aircraft->getStatus();
 	
+	aircraftData["cabins"] = json::array();
+	for (const CabinClass& cabin : aircraft->cabins)
+	{
+		aircraftData["cabins"].push_back({{"name", cabin.name}, {"firstRow", cabin.firstRow}, {"lastRow", cabin.lastRow}});
+	}
+	
 	return aircraftData;
 }
 
@@ -260,5 +352,14 @@ shared_ptr<Aircraft> AircraftCreator::createFromJson(const string& aircraftType,
 	int fleetCount = data.value("fleetCount", 0);
 	string status = data.value("status", "");
 	
-	return std::shared_ptr<Aircraft>(new Aircraft(aircraftType, manufacturer, model, totalSeats, seatLayout, rows, fleetCount, status));
+	vector<CabinClass> cabins;
+	if (data.contains("cabins") && data["cabins"].is_array())
+	{
+		for (const auto& cabin : data["cabins"])
+		{
+			cabins.push_back(CabinClass{cabin.value("name", ""), cabin.value("firstRow", 0), cabin.value("lastRow", 0)});
+		}
+	}
+	
+	return std::shared_ptr<Aircraft>(new Aircraft(aircraftType, manufacturer, model, totalSeats, seatLayout, rows, fleetCount, status, cabins));
 }
\ No newline at end of file
@@ -11,7 +11,7 @@ AircraftManager* AircraftManager::instance = nullptr;
 
 // ==================== Constructor & Singleton ====================
 
-AircraftManager::AircraftManager()
+AircraftManager::AircraftManager() : configGeneration(0)
 {
 	db = std::make_unique<Database>("Aircrafts");
 	ui = UserInterface::getInstance();
@@ -452,6 +452,7 @@ void AircraftManager::saveAircraftToDatabase(const shared_ptr<Aircraft>& aircraf
 		{
 			db->addEntry(aircraft->getAircraftType(), aircraftData);
 		}
+		invalidateAircraftConfig(aircraft->getAircraftType());
 	}
 	catch (const DatabaseException& e)
 	{
@@ -464,6 +465,7 @@ void AircraftManager::deleteAircraftFromDatabase(const string& aircraftType)
 	try
 	{
 		db->deleteEntry(aircraftType);
+		invalidateAircraftConfig(aircraftType);
 	}
 	catch (const DatabaseException& e)
 	{
@@ -471,6 +473,16 @@ void AircraftManager::deleteAircraftFromDatabase(const string& aircraftType)
 	}
 }
 
+void AircraftManager::invalidateAircraftConfig(const string& aircraftType)
+{
+	{
+		std::unique_lock<std::shared_mutex> lock(configMutex);
+		configCache.erase(aircraftType);
+		++configGeneration;
+	}
+	FlightManager::getInstance()->invalidateSeatInventories(aircraftType);
+}
+
 void AircraftManager::updateAircraftDetails(const shared_ptr<Aircraft>& aircraft)
 {
 	ui->clearScreen();
@@ -482,11 +494,12 @@ void AircraftManager::updateAircraftDetails(const shared_ptr<Aircraft>& aircraft
 	ui->println("3. Total Seats: " + std::to_string(aircraft->getTotalSeats()));
 	ui->println("4. Seat Layout: " + aircraft->getSeatLayout());
 	ui->println("5. Rows: " + std::to_string(aircraft->getRows()));
-	ui->println("6. Back to Previous Menu\n");
+	ui->println("6. Cabins: " + formatCabins(aircraft->getCabins()));
+	ui->println("7. Back to Previous Menu\n");
 	
 	try
 	{
-		int choice = ui->getChoice("Select field to update (1-6): ", 1, 6);
+		int choice = ui->getChoice("Select field to update (1-7): ", 1, 7);
 		
 		switch (choice)
 		{
@@ -529,6 +542,13 @@ void AircraftManager::updateAircraftDetails(const shared_ptr<Aircraft>& aircraft
 			}
 			case 4:  // Update Seat Layout
 			{
+				if (isAircraftUsedByFlights(aircraft->getAircraftType()))
+				{
+					ui->printError("Cannot change seat layout for an aircraft type used by flights.");
+					ui->println("Reason: Flight seat reservations are stored by position in the current layout.");
+					break;
+				}
+				
 				ui->println("\nExamples: 3-3 (single aisle), 2-4-2 (twin aisle), 3-4-3 (wide body)");
 				string newSeatLayout = creator->getValidSeatLayout();
 				
@@ -566,6 +586,13 @@ void AircraftManager::updateAircraftDetails(const shared_ptr<Aircraft>& aircraft
 			{
 				int newRows = creator->getValidRows();
 				
+				// Adding rows keeps existing seat positions; removing them would drop reserved seats
+				if (newRows < aircraft->getRows() && isAircraftUsedByFlights(aircraft->getAircraftType()))
+				{
+					ui->printError("Cannot remove rows from an aircraft type used by flights.");
+					break;
+				}
+				
 				// Show preview with new row count
 				ui->println("\nPreview with " + std::to_string(newRows) + " rows:");
 				vector<string> previewLabels;
@@ -596,7 +623,16 @@ void AircraftManager::updateAircraftDetails(const shared_ptr<Aircraft>& aircraft
 				}
 				break;
 			}
-			case 6:  // Back
+			case 6:  // Update Cabins
+			{
+				// Fare bucket counters of existing flights are re-derived for the new cabins on next load
+				vector<CabinClass> newCabins = creator->getValidCabins(aircraft->getRows());
+				aircraft->setCabins(newCabins);
+				saveAircraftToDatabase(aircraft);
+				ui->printSuccess("Cabins updated successfully: " + formatCabins(aircraft->getCabins()));
+				break;
+			}
+			case 7:  // Back
 				ui->printWarning("Returning to previous menu.");
 				return;
 			default:
@@ -644,7 +680,7 @@ void AircraftManager::displayAircraftTable(const vector<shared_ptr<Aircraft>>& a
 	}
 	
 	vector<string> headers = {
-		"Aircraft Type", "Manufacturer", "Model", "Total Seats", "Layout", "Rows", "Fleet Count", "Status"
+		"Aircraft Type", "Manufacturer", "Model", "Total Seats", "Layout", "Rows", "Cabins", "Fleet Count", "Status"
 	};
 	
 	vector<vector<string>> rows;
@@ -662,6 +698,7 @@ void AircraftManager::displayAircraftTable(const vector<shared_ptr<Aircraft>>& a
 					std::to_string(acft->getTotalSeats()),
 					acft->getSeatLayout(),
 					std::to_string(acft->getRows()),
+					formatCabins(acft->getCabins()),
 					std::to_string(acft->getFleetCount()),
 					acft->getStatus()
 				});
@@ -689,6 +726,20 @@ void AircraftManager::displayAircraftTable(const vector<shared_ptr<Aircraft>>& a
 	ui->displayTable(headers, rows);
 }
 
+string AircraftManager::formatCabins(const vector<CabinClass>& cabins)
+{
+	string result;
+	for (const CabinClass& cabin : cabins)
+	{
+		if (!result.empty())
+		{
+			result += ", ";
+		}
+		result += cabin.name + " " + std::to_string(cabin.firstRow) + "-" + std::to_string(cabin.lastRow);
+	}
+	return result;
+}
+
 // ==================== Query Methods ====================
 
 shared_ptr<Aircraft> AircraftManager::getAircraft(const string& aircraftType)
@@ -696,6 +747,93 @@ shared_ptr<Aircraft> AircraftManager::getAircraft(const string& aircraftType)
 	return loadAircraftFromDatabase(aircraftType);
 }
 
+// ==================== AircraftConfig ====================
+
+int AircraftConfig::getCabinIndex(int seatIndex) const noexcept
+{
+	if (seatIndex < 0 || seatIndex >= totalSeats)
+	{
+		return -1;
+	}
+	return rowCabins[seatIndex / seatsPerRow];
+}
+
+int AircraftConfig::findCabin(const string& cabinName) const noexcept
+{
+	for (size_t i = 0; i < cabins.size(); ++i)
+	{
+		if (cabins[i].name == cabinName)
+		{
+			return static_cast<int>(i);
+		}
+	}
+	return -1;
+}
+
+shared_ptr<const AircraftConfig> AircraftManager::getAircraftConfig(const string& aircraftType)
+{
+	unsigned long generation;
+	{
+		std::shared_lock<std::shared_mutex> lock(configMutex);
+		auto it = configCache.find(aircraftType);
+		if (it != configCache.end())
+		{
+			return it->second;
+		}
+		generation = configGeneration;
+	}
+	
+	// Built outside the lock; a concurrent invalidation makes this result uncacheable
+	shared_ptr<Aircraft> aircraft = loadAircraftFromDatabase(aircraftType);
+	if (!aircraft)
+	{
+		return nullptr;
+	}
+	
+	try
+	{
+		const SeatLayout* layout = SeatLayout::lookup(aircraft->getSeatLayout());
+		if (!layout)
+		{
+			throw AircraftException("Invalid seat layout for aircraft type " + aircraftType + ".");
+		}
+		
+		auto config = std::make_shared<AircraftConfig>();
+		config->seatLayout = aircraft->getSeatLayout();
+		config->rows = aircraft->getRows();
+		config->seatsPerRow = layout->seatsPerRow;
+		config->totalSeats = layout->seatsPerRow * config->rows;
+		config->layout = layout;
+		
+		// Cabin tables let seat, availability and fare lookups index by cabin instead of scanning rows
+		config->cabins = aircraft->getCabins();
+		if (!AircraftValidator::isValidCabins(config->cabins, config->rows))
+		{
+			config->cabins = {CabinClass{DEFAULT_CABIN_NAME, 1, config->rows}};
+		}
+		config->rowCabins.resize(config->rows);
+		for (size_t i = 0; i < config->cabins.size(); ++i)
+		{
+			const CabinClass& cabin = config->cabins[i];
+			config->cabinSeats.push_back((cabin.lastRow - cabin.firstRow + 1) * config->seatsPerRow);
+			std::fill(config->rowCabins.begin() + (cabin.firstRow - 1), config->rowCabins.begin() + cabin.lastRow,
+			          static_cast<int>(i));
+		}
+		
+		std::unique_lock<std::shared_mutex> lock(configMutex);
+		if (generation == configGeneration)
+		{
+			configCache[aircraftType] = config;
+		}
+		return config;
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError("Error loading aircraft: " + string(e.what()));
+		return nullptr;
+	}
+}
+
 vector<string> AircraftManager::getAllAircraftTypes()
 {
 	vector<string> aircraftTypes;
@@ -730,25 +868,14 @@ bool AircraftManager::aircraftTypeExists(const string& aircraftType)
 
 bool AircraftManager::isAircraftUsedByFlights(const string& aircraftType)
 {
-	// Query FlightManager to check if any flights use this aircraft type
+	// Query FlightManager's aircraft type index
 	try
 	{
-		vector<string> flightNumbers = FlightManager::getInstance()->getAllFlightNumbers();
-		
-		for (const auto& flightNumber : flightNumbers)
-		{
-			shared_ptr<Flight> flight = FlightManager::getInstance()->getFlight(flightNumber);
-			if (flight && flight->getAircraftType() == aircraftType)
-			{
-				return true;  // Aircraft is used by at least one flight
-			}
-		}
+		return FlightManager::getInstance()->isAircraftTypeInUse(aircraftType);
 	}
 	catch (const std::exception& e)
 	{
 		// If there's an error, assume it's in use to be safe
 		return true;
 	}
-	
-	return false;  // Aircraft is not used by any flights
 }
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "AirlineManagementSystem.hpp"
+#include "CapacityManager.hpp"
+#include "JobScheduler.hpp"
 #include <iostream>
 
 // ==================== Static Member Initialization ====================
@@ -31,6 +33,7 @@ AirlineManagementSystem::AirlineManagementSystem()
 	try
 	{
 		usersManager = UsersManager::getInstance();
+		CapacityManager::getInstance();	// Registers the no-show model refresh job
 		
 		ui->printSuccess("System initialized successfully!");
 	}
@@ -49,6 +52,7 @@ void AirlineManagementSystem::runSystem()
 	
 	while (running)
 	{
+		JobScheduler::getInstance()->runDueJobs();
 		ui->clearScreen();
 		displayWelcomeBanner();
 		
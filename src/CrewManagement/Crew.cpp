@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cctype>
+#include <ctime>
 #include "Crew.hpp"
 
 // ==================== Crew Constructor ====================
@@ -52,6 +53,22 @@ double Crew::getTotalFlightHours() const noexcept
 	return totalFlightHours;
 }
 
+double Crew::getMonthlyHours(const string& month) const
+{
+	auto it = monthlyHours.find(month);
+	return it != monthlyHours.end() ? it->second : 0.0;
+}
+
+const std::map<string, double>& Crew::getMonthlyHoursHistory() const noexcept
+{
+	return monthlyHours;
+}
+
+const std::map<string, std::set<string>>& Crew::getCreditedFlights() const noexcept
+{
+	return creditedFlights;
+}
+
 // ==================== Setters ====================
 
 void Crew::setName(const string& name) noexcept
@@ -71,12 +88,30 @@ void Crew::setStatus(CrewStatus status) noexcept
 
 // ==================== Flight Hours ====================
 
-void Crew::addFlightHours(double hours) noexcept
+bool Crew::addFlightHours(double hours, const string& month, const string& flightNumber)
 {
+	if (!flightNumber.empty() && !month.empty())
+	{
+		if (!creditedFlights[month].insert(flightNumber).second)
+		{
+			return false;
+		}
+	}
+	
 	if (hours > 0)
 	{
 		totalFlightHours += hours;
+		if (!month.empty())
+		{
+			monthlyHours[month] += hours;
+		}
 	}
+	return true;
+}
+
+void Crew::pruneCreditedFlights(const string& oldestMonth)
+{
+	creditedFlights.erase(creditedFlights.begin(), creditedFlights.lower_bound(oldestMonth));
 }
 
 // ==================== Validation and Conversion Methods ====================
@@ -166,6 +201,27 @@ CrewStatus Crew::stringToStatus(const string& statusStr)
 	throw CrewException("Invalid status. Must be Available, Assigned, or On Leave.");
 }
 
+string Crew::getCurrentMonth()
+{
+	std::time_t now = std::time(nullptr);
+	char buffer[8];
+	std::strftime(buffer, sizeof(buffer), "%Y-%m", std::localtime(&now));
+	return buffer;
+}
+
+string Crew::getMonthsAgo(int months)
+{
+	std::time_t now = std::time(nullptr);
+	std::tm date = *std::localtime(&now);
+	date.tm_mday = 1;
+	date.tm_mon -= months;
+	std::time_t then = std::mktime(&date);
+	
+	char buffer[8];
+	std::strftime(buffer, sizeof(buffer), "%Y-%m", std::localtime(&then));
+	return buffer;
+}
+
 // ==================== CrewException Class ====================
 
 CrewException::CrewException(const string& message) : message(message) {}
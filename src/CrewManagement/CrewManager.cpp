@@ -1,6 +1,9 @@
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
+#include <chrono>
+#include <limits>
+#include <unordered_set>
 #include "CrewManager.hpp"
 #include "FlightManager.hpp"
 #include "Flight.hpp"
@@ -41,6 +44,7 @@ void CrewManager::manageCrew()
 			"View Crew Details",
 			"Update Crew Member",
 			"Remove Crew Member",
+			"Auto-Roster Flights",
 			"Back to Main Menu"
 		};
 		
@@ -48,7 +52,7 @@ void CrewManager::manageCrew()
 		
 		try
 		{
-			int choice = ui->getChoice("Enter choice: ", 1, 6);
+			int choice = ui->getChoice("Enter choice: ", 1, 7);
 			
 			switch (choice)
 			{
@@ -68,6 +72,9 @@ void CrewManager::manageCrew()
 					removeCrewMember();
 					break;
 				case 6:
+					rosterFlights();
+					break;
+				case 7:
 					return;
 				default:
 					ui->printError("Invalid choice.");
@@ -153,15 +160,7 @@ void CrewManager::viewAllCrew()
 		{
 			try
 			{
-				string name = crewData.value("name", "");
-				string roleStr = crewData.value("role", "Pilot");
-				string statusStr = crewData.value("status", "Available");
-				double hours = crewData.value("totalFlightHours", 0.0);
-				
-				CrewRole role = Crew::stringToRole(roleStr);
-				CrewStatus status = Crew::stringToStatus(statusStr);
-				
-				crew.push_back(std::shared_ptr<Crew>(new Crew(crewId, name, role, status, hours)));
+				crew.push_back(crewFromJson(crewId, crewData));
 			}
 			catch (const std::exception& e)
 			{
@@ -201,8 +200,17 @@ void CrewManager::viewCrewDetails()
 		ui->println("Crew ID: " + crew->getCrewId());
 		ui->println("Name: " + crew->getName());
 		ui->println("Role: " + Crew::roleToString(crew->getRole()));
-		ui->println("Status: " + Crew::statusToString(crew->getStatus()));
+		ui->println("Status: " + Crew::statusToString(getEffectiveStatus(crew)));
 		ui->println("Total Flight Hours: " + std::to_string(static_cast<int>(crew->getTotalFlightHours())));
+		ui->println("Hours This Month: " + std::to_string(static_cast<int>(crew->getMonthlyHours(Crew::getCurrentMonth()))));
+		
+		vector<string> flightNumbers = FlightManager::getInstance()->getFlightsForCrew(crewId);
+		string roster;
+		for (const string& flightNumber : flightNumbers)
+		{
+			roster += (roster.empty() ? "" : ", ") + flightNumber;
+		}
+		ui->println("Assigned Flights: " + (roster.empty() ? string("None") : roster));
 	}
 	catch (const std::exception& e)
 	{
@@ -322,6 +330,59 @@ void CrewManager::removeCrewMember()
 	ui->pauseScreen();
 }
 
+void CrewManager::rosterFlights()
+{
+	ui->clearScreen();
+	ui->printHeader("Auto-Roster Flights");
+	
+	try
+	{
+		string fromDate = ui->getDate("From Date: ", "YYYY-MM-DD");
+		string toDate = ui->getDate("To Date: ", "YYYY-MM-DD");
+		
+		auto started = std::chrono::steady_clock::now();
+		RosterResult result = FlightManager::getInstance()->rosterCrew(fromDate, toDate);
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+		
+		if (result.slotsRequired == 0)
+		{
+			ui->printWarning("No open crew slots on scheduled flights in this period.");
+			ui->pauseScreen();
+			return;
+		}
+		
+		vector<vector<string>> rows;
+		for (const auto& [flightNumber, crewId] : result.assignments)
+		{
+			rows.push_back({flightNumber, crewId});
+		}
+		if (!rows.empty())
+		{
+			ui->displayTable({"Flight Number", "Crew ID"}, rows);
+		}
+		
+		ui->printSuccess("Filled " + std::to_string(result.slotsFilled) + " of " + std::to_string(result.slotsRequired) +
+		                 " open crew slots in " + std::to_string(elapsed.count()) + " ms (" +
+		                 std::to_string(result.threadsUsed) + " threads).");
+		
+		if (!result.understaffedFlights.empty())
+		{
+			string flights;
+			for (const string& flightNumber : result.understaffedFlights)
+			{
+				flights += (flights.empty() ? "" : ", ") + flightNumber;
+			}
+			ui->printWarning("Still understaffed (overlap, rest or monthly hour limits): " + flights);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
 // ==================== Helper Methods ====================
 
 shared_ptr<Crew> CrewManager::loadCrewFromDatabase(const string& crewId)
@@ -333,17 +394,7 @@ shared_ptr<Crew> CrewManager::loadCrewFromDatabase(const string& crewId)
 	
 	try
 	{
-		json crewData = db->getEntry(crewId);
-		
-		string name = crewData.value("name", "");
-		string roleStr = crewData.value("role", "Pilot");
-		string statusStr = crewData.value("status", "Available");
-		double hours = crewData.value("totalFlightHours", 0.0);
-		
-		CrewRole role = Crew::stringToRole(roleStr);
-		CrewStatus status = Crew::stringToStatus(statusStr);
-		
-		return std::shared_ptr<Crew>(new Crew(crewId, name, role, status, hours));
+		return crewFromJson(crewId, db->getEntry(crewId));
 	}
 	catch (const std::exception& e)
 	{
@@ -361,11 +412,7 @@ void CrewManager::saveCrewToDatabase(const shared_ptr<Crew>& crew)
 	
 	try
 	{
-		json crewData;
-		crewData["name"] = crew->getName();
-		crewData["role"] = Crew::roleToString(crew->getRole());
-		crewData["status"] = Crew::statusToString(crew->getStatus());
-		crewData["totalFlightHours"] = crew->getTotalFlightHours();
+		json crewData = crewToJson(crew);
 		
 		if (db->entryExists(crew->getCrewId()))
 		{
@@ -380,6 +427,35 @@ void CrewManager::saveCrewToDatabase(const shared_ptr<Crew>& crew)
 	{
 		throw CrewException("An error occurred while accessing the database." + string(e.what()));
 	}
+	
+	if (crewIndexBuilt)
+	{
+		indexCrew(crew);
+	}
+}
+
+json CrewManager::crewToJson(const shared_ptr<Crew>& crew)
+{
+	json crewData;
+	crewData["name"] = crew->getName();
+	crewData["role"] = Crew::roleToString(crew->getRole());
+	crewData["status"] = Crew::statusToString(crew->getStatus());
+	crewData["totalFlightHours"] = crew->getTotalFlightHours();
+	crewData["monthlyHours"] = crew->getMonthlyHoursHistory();
+	crewData["creditedFlights"] = crew->getCreditedFlights();
+	return crewData;
+}
+
+shared_ptr<Crew> CrewManager::crewFromJson(const string& crewId, const json& crewData)
+{
+	CrewRole role = Crew::stringToRole(crewData.value("role", "Pilot"));
+	CrewStatus status = Crew::stringToStatus(crewData.value("status", "Available"));
+	
+	shared_ptr<Crew> crew(new Crew(crewId, crewData.value("name", ""), role, status,
+	                               crewData.value("totalFlightHours", 0.0)));
+	crew->monthlyHours = crewData.value("monthlyHours", std::map<string, double>());
+	crew->creditedFlights = crewData.value("creditedFlights", std::map<string, std::set<string>>());
+	return crew;
 }
 
 void CrewManager::deleteCrewFromDatabase(const string& crewId)
@@ -392,6 +468,87 @@ void CrewManager::deleteCrewFromDatabase(const string& crewId)
 	{
 		throw CrewException("An error occurred while accessing the database." + string(e.what()));
 	}
+	
+	unindexCrew(crewId);
+}
+
+void CrewManager::buildCrewIndex()
+{
+	if (crewIndexBuilt)
+	{
+		return;
+	}
+	
+	json allCrewData;
+	try
+	{
+		allCrewData = db->loadAll();
+	}
+	catch (const std::exception& e)
+	{
+		// Left unbuilt, so the next lookup tries again
+		ui->printError(string(e.what()));
+		return;
+	}
+	
+	for (const auto& [crewId, crewData] : allCrewData.items())
+	{
+		try
+		{
+			indexCrew(crewFromJson(crewId, crewData));
+		}
+		catch (const std::exception& e)
+		{
+			// Skip crew with errors
+			continue;
+		}
+	}
+	
+	crewIndexBuilt = true;
+}
+
+void CrewManager::indexCrew(const shared_ptr<Crew>& crew)
+{
+	// The caller may keep editing its object, so the index holds its own copy
+	auto snapshot = std::shared_ptr<Crew>(new Crew(*crew));
+	
+	auto it = crewSlots.find(snapshot->getCrewId());
+	if (it != crewSlots.end() && it->second.role == snapshot->getRole() && it->second.status == snapshot->getStatus())
+	{
+		getCrewBucket(snapshot->getRole(), snapshot->getStatus())[it->second.position] = snapshot;
+		return;
+	}
+	
+	unindexCrew(snapshot->getCrewId());
+	
+	vector<shared_ptr<Crew>>& bucket = getCrewBucket(snapshot->getRole(), snapshot->getStatus());
+	crewSlots[snapshot->getCrewId()] = CrewSlot{snapshot->getRole(), snapshot->getStatus(), bucket.size()};
+	bucket.push_back(std::move(snapshot));
+}
+
+void CrewManager::unindexCrew(const string& crewId)
+{
+	auto it = crewSlots.find(crewId);
+	if (it == crewSlots.end())
+	{
+		return;
+	}
+	
+	// Swap-remove: the last member takes the vacated position
+	vector<shared_ptr<Crew>>& bucket = getCrewBucket(it->second.role, it->second.status);
+	size_t position = it->second.position;
+	if (position + 1 != bucket.size())
+	{
+		bucket[position] = std::move(bucket.back());
+		crewSlots[bucket[position]->getCrewId()].position = position;
+	}
+	bucket.pop_back();
+	crewSlots.erase(it);
+}
+
+vector<shared_ptr<Crew>>& CrewManager::getCrewBucket(CrewRole role, CrewStatus status)
+{
+	return crewBuckets[static_cast<int>(role)][static_cast<int>(status)];
 }
 
 void CrewManager::displayCrewTable(const vector<shared_ptr<Crew>>& crew, const string& title)
@@ -418,7 +575,7 @@ void CrewManager::displayCrewTable(const vector<shared_ptr<Crew>>& crew, const s
 					member->getCrewId(),
 					member->getName(),
 					Crew::roleToString(member->getRole()),
-					Crew::statusToString(member->getStatus()),
+					Crew::statusToString(getEffectiveStatus(member)),
 					std::to_string(static_cast<int>(member->getTotalFlightHours()))
 				});
 			}
@@ -473,44 +630,22 @@ shared_ptr<Crew> CrewManager::getCrew(const string& crewId)
 	return loadCrewFromDatabase(crewId);
 }
 
-vector<shared_ptr<Crew>> CrewManager::getAvailableCrew(CrewRole role)
+vector<shared_ptr<Crew>> CrewManager::getAvailableCrew(CrewRole role, std::time_t from, std::time_t to)
 {
-	vector<shared_ptr<Crew>> available;
+	buildCrewIndex();
 	
-	try
+	// The status flag only rules out leave; an assigned member is free outside their flights.
+	// One query over the flights in the window names everyone busy, instead of one per member.
+	std::unordered_set<string> busy = FlightManager::getInstance()->getBusyCrew(from, to);
+	vector<shared_ptr<Crew>> available;
+	for (CrewStatus status : {CrewStatus::AVAILABLE, CrewStatus::ASSIGNED})
 	{
-		json allCrewData = db->loadAll();
-		
-		for (const auto& [crewId, crewData] : allCrewData.items())
+		for (const auto& crew : getCrewBucket(role, status))
 		{
-			try
-			{
-				string name = crewData.value("name", "");
-				string roleStr = crewData.value("role", "Pilot");
-				string statusStr = crewData.value("status", "Available");
-				double hours = crewData.value("totalFlightHours", 0.0);
-				
-				CrewRole crewRole = Crew::stringToRole(roleStr);
-				CrewStatus crewStatus = Crew::stringToStatus(statusStr);
-				auto crew = std::shared_ptr<Crew>(new Crew(crewId, name, crewRole, crewStatus, hours));
-				
-				if (crew->getRole() == role &&
-					crew->getStatus() == CrewStatus::AVAILABLE)
-				{
-					available.push_back(crew);
-				}
-			}
-			catch (const std::exception& e)
-			{
-				continue;
-			}
+			if (busy.find(crew->getCrewId()) == busy.end())
+				available.push_back(crew);
 		}
 	}
-	catch (const std::exception& e)
-	{
-		ui->printError(string(e.what()));
-	}
-	
 	return available;
 }
 
@@ -557,56 +692,84 @@ bool CrewManager::crewExists(const string& crewId)
 	}
 }
 
-// ==================== Status Update Methods ====================
+// ==================== Status ====================
 
-void CrewManager::markCrewAsAssigned(const string& crewId)
+CrewStatus CrewManager::getEffectiveStatus(const shared_ptr<Crew>& crew)
 {
-	try
+	if (crew->getStatus() == CrewStatus::ON_LEAVE)
 	{
-		shared_ptr<Crew> crew = loadCrewFromDatabase(crewId);
-		if (crew)
-		{
-			crew->setStatus(CrewStatus::ASSIGNED);
-			saveCrewToDatabase(crew);
-		}
-	}
-	catch (const std::exception& e)
-	{
-		ui->printError(string(e.what()));
+		return CrewStatus::ON_LEAVE;
 	}
+	
+	// Any duty from now on (including one in progress) counts as assigned
+	bool onDuty = !FlightManager::getInstance()->isCrewFree(crew->getCrewId(), std::time(nullptr),
+	                                                        std::numeric_limits<std::time_t>::max());
+	return onDuty ? CrewStatus::ASSIGNED : CrewStatus::AVAILABLE;
 }
 
-void CrewManager::markCrewAsAvailable(const string& crewId)
+void CrewManager::applyCrewLedger(const vector<CrewLedgerEntry>& entries)
 {
-	try
+	// Each member is loaded once, however many entries name them
+	std::unordered_map<string, shared_ptr<Crew>> changed;
+	for (const CrewLedgerEntry& entry : entries)
 	{
-		shared_ptr<Crew> crew = loadCrewFromDatabase(crewId);
-		if (crew)
+		auto it = changed.find(entry.crewId);
+		if (it == changed.end())
+		{
+			shared_ptr<Crew> crew = loadCrewFromDatabase(entry.crewId);
+			if (!crew)
+			{
+				continue;
+			}
+			it = changed.emplace(entry.crewId, crew).first;
+		}
+		
+		if (!it->second->addFlightHours(entry.hours, entry.month, entry.flightNumber))
+		{
+			continue;
+		}
+		
+		// Leave is set by an administrator and outlasts any flight
+		if (it->second->getStatus() != CrewStatus::ON_LEAVE)
 		{
-			crew->setStatus(CrewStatus::AVAILABLE);
-			saveCrewToDatabase(crew);
+			it->second->setStatus(entry.newStatus);
 		}
 	}
-	catch (const std::exception& e)
+	
+	// Retries follow within minutes, so only recent months of credited flights are kept. A month
+	// in this ledger is never dropped: its flights are marked Completed only after this write,
+	// so a retry after that step fails must still find them credited
+	string oldestMonth = Crew::getMonthsAgo(CREW_CREDIT_HISTORY_MONTHS - 1);
+	for (const CrewLedgerEntry& entry : entries)
 	{
-		ui->printError(string(e.what()));
+		if (!entry.month.empty() && entry.month < oldestMonth)
+		{
+			oldestMonth = entry.month;
+		}
 	}
-}
-
-void CrewManager::addFlightHoursForCrew(const string& crewId, double hours)
-{
+	
+	json updates = json::object();
+	for (const auto& [crewId, crew] : changed)
+	{
+		crew->pruneCreditedFlights(oldestMonth);
+		updates[crewId] = crewToJson(crew);
+	}
+	
 	try
 	{
-		shared_ptr<Crew> crew = loadCrewFromDatabase(crewId);
-		if (crew)
-		{
-			crew->addFlightHours(hours);
-			saveCrewToDatabase(crew);
-		}
+		db->upsertEntries(updates);
 	}
-	catch (const std::exception& e)
+	catch (const DatabaseException& e)
 	{
-		ui->printError(string(e.what()));
+		throw CrewException("An error occurred while accessing the database." + string(e.what()));
+	}
+	
+	if (crewIndexBuilt)
+	{
+		for (const auto& [crewId, crew] : changed)
+		{
+			indexCrew(crew);
+		}
 	}
 }
 
@@ -616,7 +779,8 @@ bool CrewManager::isCrewAssignedToFlights(const string& crewId)
 {
 	try
 	{
-		vector<string> flightNumbers = FlightManager::getInstance()->getAllFlightNumbers();
+		// Only this member's flights are loaded, to check their status
+		vector<string> flightNumbers = FlightManager::getInstance()->getFlightsForCrew(crewId);
 		
 		for (const string& flightNumber : flightNumbers)
 		{
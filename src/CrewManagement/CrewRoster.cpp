@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <array>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include "CrewRoster.hpp"
+
+namespace
+{
+	constexpr int ROLE_COUNT = 3;
+	constexpr std::time_t REST_SECONDS = static_cast<std::time_t>(CREW_MIN_REST_HOURS) * 3600;
+	
+	// One flight in a member's schedule; flight is -1 for commitments made before this roster
+	struct Duty
+	{
+		std::time_t start;
+		std::time_t end;
+		int flight;
+	};
+	
+	struct MemberState
+	{
+		vector<Duty> duties;	// Sorted by start
+		std::unordered_map<int, double> monthHours;
+	};
+}
+
+struct CrewRoster::Attempt
+{
+	vector<MemberState> members;
+	vector<vector<int>> rostered;				// Flight -> members assigned by this roster
+	vector<std::array<int, ROLE_COUNT>> open;	// Flight -> unfilled slots per role
+	int slotsFilled = 0;
+	double hourSpread = 0.0;	// Sum of squared monthly hours; lower is more even
+	
+	bool isFeasible(const vector<RosterFlight>& flights, int member, int flight) const
+	{
+		const RosterFlight& target = flights[flight];
+		const MemberState& state = members[member];
+		
+		auto hours = state.monthHours.find(target.month);
+		if ((hours != state.monthHours.end() ? hours->second : 0.0) + target.hours > CREW_MAX_MONTHLY_HOURS)
+		{
+			return false;
+		}
+		
+		// Only the neighbours in departure order can overlap or cut into the rest period
+		auto next = std::lower_bound(state.duties.begin(), state.duties.end(), target.departure,
+		                             [](const Duty& duty, std::time_t start) { return duty.start < start; });
+		if (next != state.duties.begin() && std::prev(next)->end + REST_SECONDS > target.departure)
+		{
+			return false;
+		}
+		return next == state.duties.end() || target.arrival + REST_SECONDS <= next->start;
+	}
+	
+	void assign(const vector<RosterFlight>& flights, int member, int flight)
+	{
+		const RosterFlight& target = flights[flight];
+		MemberState& state = members[member];
+		
+		auto next = std::lower_bound(state.duties.begin(), state.duties.end(), target.departure,
+		                             [](const Duty& duty, std::time_t start) { return duty.start < start; });
+		state.duties.insert(next, Duty{target.departure, target.arrival, flight});
+		state.monthHours[target.month] += target.hours;
+		rostered[flight].push_back(member);
+	}
+	
+	void unassign(const vector<RosterFlight>& flights, int member, int flight)
+	{
+		MemberState& state = members[member];
+		state.duties.erase(std::find_if(state.duties.begin(), state.duties.end(),
+		                                [flight](const Duty& duty) { return duty.flight == flight; }));
+		state.monthHours[flights[flight].month] -= flights[flight].hours;
+		
+		vector<int>& onFlight = rostered[flight];
+		onFlight.erase(std::find(onFlight.begin(), onFlight.end(), member));
+	}
+};
+
+// ==================== Constructor ====================
+
+CrewRoster::CrewRoster(vector<RosterFlight> flights, vector<RosterCrew> crew)
+	: flights(std::move(flights)), crew(std::move(crew))
+{
+	std::stable_sort(this->flights.begin(), this->flights.end(),
+	                 [](const RosterFlight& a, const RosterFlight& b) { return a.departure < b.departure; });
+}
+
+// ==================== Solving ====================
+
+RosterResult CrewRoster::solve() const
+{
+	size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+	
+	// Independent searches that differ only in tie-breaking; seed 0 is the plain greedy roster
+	vector<Attempt> attempts(threadCount);
+	{
+		vector<std::thread> workers;
+		for (size_t t = 0; t < threadCount; ++t)
+		{
+			workers.emplace_back([this, &attempts, t]() { attempts[t] = solveWithSeed(static_cast<uint32_t>(t)); });
+		}
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+	}
+	
+	const Attempt& best = *std::min_element(attempts.begin(), attempts.end(), [](const Attempt& a, const Attempt& b) {
+		return a.slotsFilled != b.slotsFilled ? a.slotsFilled > b.slotsFilled : a.hourSpread < b.hourSpread;
+	});
+	
+	RosterResult result;
+	result.threadsUsed = threadCount;
+	result.slotsFilled = best.slotsFilled;
+	for (size_t f = 0; f < flights.size(); ++f)
+	{
+		for (int member : best.rostered[f])
+		{
+			result.assignments.emplace_back(flights[f].flightNumber, crew[member].crewId);
+		}
+		
+		int open = 0;
+		for (int slots : best.open[f])
+		{
+			open += slots;
+		}
+		result.slotsRequired += open + static_cast<int>(best.rostered[f].size());
+		if (open > 0)
+		{
+			result.understaffedFlights.push_back(flights[f].flightNumber);
+		}
+	}
+	
+	return result;
+}
+
+int CrewRoster::getRequiredCount(CrewRole role) noexcept
+{
+	switch (role)
+	{
+		case CrewRole::PILOT: return ROSTER_PILOTS_PER_FLIGHT;
+		case CrewRole::COPILOT: return ROSTER_COPILOTS_PER_FLIGHT;
+		default: return ROSTER_ATTENDANTS_PER_FLIGHT;
+	}
+}
+
+// ==================== Helper Methods ====================
+
+CrewRoster::Attempt CrewRoster::solveWithSeed(uint32_t seed) const
+{
+	Attempt attempt;
+	attempt.members.resize(crew.size());
+	attempt.rostered.resize(flights.size());
+	attempt.open.resize(flights.size());
+	
+	std::unordered_map<string, CrewRole> roleOf;
+	vector<vector<int>> membersByRole(ROLE_COUNT);
+	for (size_t m = 0; m < crew.size(); ++m)
+	{
+		roleOf[crew[m].crewId] = crew[m].role;
+		membersByRole[static_cast<int>(crew[m].role)].push_back(static_cast<int>(m));
+		
+		MemberState& state = attempt.members[m];
+		for (const RosterFlight& commitment : crew[m].commitments)
+		{
+			state.duties.push_back(Duty{commitment.departure, commitment.arrival, -1});
+			state.monthHours[commitment.month] += commitment.hours;
+		}
+		std::sort(state.duties.begin(), state.duties.end(),
+		          [](const Duty& a, const Duty& b) { return a.start < b.start; });
+	}
+	
+	// Slots still open on each flight after the crew already assigned to it
+	for (size_t f = 0; f < flights.size(); ++f)
+	{
+		for (int r = 0; r < ROLE_COUNT; ++r)
+		{
+			attempt.open[f][r] = getRequiredCount(static_cast<CrewRole>(r));
+		}
+		for (const string& crewId : flights[f].assignedCrew)
+		{
+			auto it = roleOf.find(crewId);
+			if (it != roleOf.end())
+			{
+				int& open = attempt.open[f][static_cast<int>(it->second)];
+				open = std::max(open - 1, 0);
+			}
+		}
+	}
+	
+	// Greedy pass in departure order: each slot goes to the feasible member with the fewest
+	// hours that month, with a little seeded noise so each thread explores a different roster
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<double> noise(0.0, seed == 0 ? 0.0 : 2.0);
+	for (int f = 0; f < static_cast<int>(flights.size()); ++f)
+	{
+		for (int r = 0; r < ROLE_COUNT; ++r)
+		{
+			while (attempt.open[f][r] > 0)
+			{
+				int best = -1;
+				double bestScore = 0.0;
+				for (int m : membersByRole[r])
+				{
+					if (!attempt.isFeasible(flights, m, f))
+						continue;
+					
+					auto hours = attempt.members[m].monthHours.find(flights[f].month);
+					double score = (hours != attempt.members[m].monthHours.end() ? hours->second : 0.0) + noise(rng);
+					if (best < 0 || score < bestScore)
+					{
+						best = m;
+						bestScore = score;
+					}
+				}
+				
+				if (best < 0)
+					break;
+				attempt.assign(flights, best, f);
+				--attempt.open[f][r];
+				++attempt.slotsFilled;
+			}
+		}
+	}
+	
+	// Local search: an unfilled slot is taken by a member blocked by exactly one rostered flight,
+	// if another member of the same role can fly that flight instead
+	for (int round = 0; round < ROSTER_REPAIR_ROUNDS; ++round)
+	{
+		bool improved = false;
+		for (int f = 0; f < static_cast<int>(flights.size()); ++f)
+		{
+			for (int r = 0; r < ROLE_COUNT; ++r)
+			{
+				for (int m : membersByRole[r])
+				{
+					if (attempt.open[f][r] == 0)
+						break;
+					
+					const RosterFlight& target = flights[f];
+					int blocking = -1;
+					int blockers = 0;
+					for (const Duty& duty : attempt.members[m].duties)
+					{
+						if (duty.end + REST_SECONDS > target.departure && target.arrival + REST_SECONDS > duty.start)
+						{
+							blocking = duty.flight;
+							++blockers;
+						}
+					}
+					if (blockers != 1 || blocking < 0)
+						continue;
+					
+					attempt.unassign(flights, m, blocking);
+					if (attempt.isFeasible(flights, m, f))
+					{
+						auto substitute = std::find_if(membersByRole[r].begin(), membersByRole[r].end(), [&](int other) {
+							return other != m && attempt.isFeasible(flights, other, blocking);
+						});
+						if (substitute != membersByRole[r].end())
+						{
+							attempt.assign(flights, *substitute, blocking);
+							attempt.assign(flights, m, f);
+							--attempt.open[f][r];
+							++attempt.slotsFilled;
+							improved = true;
+							continue;
+						}
+					}
+					attempt.assign(flights, m, blocking);
+				}
+			}
+		}
+		
+		if (!improved)
+			break;
+	}
+	
+	for (const MemberState& state : attempt.members)
+	{
+		for (const auto& [month, hours] : state.monthHours)
+		{
+			attempt.hourSpread += hours * hours;
+		}
+	}
+	
+	return attempt;
+}
@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <iomanip>
+#include <sstream>
 #include "Flight.hpp"
 #include "Aircraft.hpp"
 #include "AircraftManager.hpp"
@@ -10,12 +12,14 @@ Flight::Flight(const string& flightNumber, const string& origin, const string& d
               const string& departureDateTime, const string& arrivalDateTime,
               const string& aircraftType, const string& status, double price,
               const string& gate, const string& boardingTime,
-              const vector<string>& reservedSeats,
-			const vector<string>& assignedCrewIds)
+              const SeatBitset& seatOccupancy,
+              const vector<string>& assignedCrewIds,
+              const vector<FareBucket>& fareBuckets)
 	: flightNumber(flightNumber), origin(origin), destination(destination),
 	  departureDateTime(departureDateTime), arrivalDateTime(arrivalDateTime),
 	  aircraftType(aircraftType), status(status), price(price),
-	  gate(gate), boardingTime(boardingTime), reservedSeats(reservedSeats), assignedCrewIds(assignedCrewIds)
+	  gate(gate), boardingTime(boardingTime), seatOccupancy(seatOccupancy), assignedCrewIds(assignedCrewIds),
+	  fareBuckets(fareBuckets)
 {
 }
 
@@ -63,29 +67,20 @@ double Flight::getPrice() const noexcept
 
 int Flight::getTotalSeats() const
 {
-	// Query AircraftManager for seat count based on aircraft type
-	try
-	{
-		shared_ptr<Aircraft> aircraft = AircraftManager::getInstance()->getAircraft(aircraftType);
-		if (!aircraft)
-		{
-			throw FlightException("Invalid or missing aircraft type.");
-		}
-		
-		string seatLayout = aircraft->getSeatLayout();
-		int rows = aircraft->getRows();
-		return SeatMap::calculateSeatCount(seatLayout, rows);
-	}
-	catch (const SeatMapException& e)
+	// Seat count is precomputed in the cached aircraft configuration
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	if (!config)
 	{
-		throw FlightException("An error occurred while accessing the database.");
+		throw FlightException("Invalid or missing aircraft type.");
 	}
+	
+	return config->totalSeats;
 }
 
 int Flight::getAvailableSeats() const
 {
 	int totalSeats = getTotalSeats();
-	return totalSeats - static_cast<int>(reservedSeats.size());
+	return totalSeats - seatOccupancy.count();
 }
 
 string Flight::getGate() const noexcept
@@ -98,15 +93,136 @@ string Flight::getBoardingTime() const noexcept
 	return boardingTime;
 }
 
-vector<string> Flight::getReservedSeats() const noexcept
+vector<string> Flight::getReservedSeats() const
+{
+	// String adapter over the occupancy bitset
+	vector<string> seats;
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	if (!config)
+	{
+		return seats;
+	}
+	
+	for (int seatIndex = 0; seatIndex < seatOccupancy.size(); ++seatIndex)
+	{
+		if (seatOccupancy.test(seatIndex))
+		{
+			seats.push_back(SeatMap::indexToSeat(seatIndex, *config->layout));
+		}
+	}
+	return seats;
+}
+
+int Flight::getReservedSeatCount() const noexcept
+{
+	return seatOccupancy.count();
+}
+
+const SeatBitset& Flight::getSeatOccupancy() const noexcept
 {
-	return reservedSeats;
+	return seatOccupancy;
 }
+
 vector<string> Flight::getAssignedCrew() const noexcept
 {
 	return assignedCrewIds;
 }
 
+// ==================== Fare Buckets ====================
+
+const vector<FareBucket>& Flight::getFareBuckets() const noexcept
+{
+	return fareBuckets;
+}
+
+int Flight::getCabinAvailableSeats(size_t cabinIndex) const
+{
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	if (!config || cabinIndex >= fareBuckets.size() || cabinIndex >= config->cabinSeats.size())
+	{
+		throw FlightException("Invalid cabin for this aircraft.");
+	}
+	
+	return std::max(config->cabinSeats[cabinIndex] - fareBuckets[cabinIndex].sold, 0);
+}
+
+int Flight::getSeatCabin(const string& seatNumber) const
+{
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	if (!config)
+	{
+		return -1;
+	}
+	
+	int cabinIndex = config->getCabinIndex(SeatMap::seatToIndex(seatNumber, *config->layout, config->rows));
+	return cabinIndex < static_cast<int>(fareBuckets.size()) ? cabinIndex : -1;
+}
+
+double Flight::getSeatPrice(const string& seatNumber) const
+{
+	int cabinIndex = getSeatCabin(seatNumber);
+	return cabinIndex >= 0 ? fareBuckets[cabinIndex].price : price;
+}
+
+void Flight::setCabinPrice(size_t cabinIndex, double price)
+{
+	if (cabinIndex >= fareBuckets.size())
+	{
+		throw FlightException("Invalid cabin for this aircraft.");
+	}
+	
+	fareBuckets[cabinIndex].price = price;
+	
+	this->price = fareBuckets.front().price;
+	for (const FareBucket& bucket : fareBuckets)
+	{
+		this->price = std::min(this->price, bucket.price);
+	}
+}
+
+void Flight::adjustSoldCount(int seatIndex, int delta)
+{
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	int cabinIndex = config ? config->getCabinIndex(seatIndex) : -1;
+	if (cabinIndex >= 0 && cabinIndex < static_cast<int>(fareBuckets.size()))
+	{
+		fareBuckets[cabinIndex].sold += delta;
+	}
+}
+
+void Flight::alignFareBuckets()
+{
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	if (!config)
+	{
+		return;
+	}
+	
+	vector<FareBucket> aligned;
+	aligned.reserve(config->cabins.size());
+	
+	for (const CabinClass& cabin : config->cabins)
+	{
+		auto it = std::find_if(fareBuckets.begin(), fareBuckets.end(),
+		                       [&cabin](const FareBucket& bucket) { return bucket.cabin == cabin.name; });
+		aligned.push_back(it != fareBuckets.end() ? *it : FareBucket{cabin.name, price, 0});
+	}
+	
+	// Counters are only as good as the rows they were counted over; cabins are contiguous row ranges
+	for (size_t i = 0; i < aligned.size(); ++i)
+	{
+		const CabinClass& cabin = config->cabins[i];
+		if (aligned[i].firstRow != cabin.firstRow || aligned[i].lastRow != cabin.lastRow)
+		{
+			aligned[i].sold = seatOccupancy.count((cabin.firstRow - 1) * config->seatsPerRow, cabin.lastRow * config->seatsPerRow);
+			aligned[i].firstRow = cabin.firstRow;
+			aligned[i].lastRow = cabin.lastRow;
+		}
+	}
+	
+	fareBuckets = std::move(aligned);
+}
+
 // ==================== Setters ====================
 
 void Flight::setStatus(const string& status) noexcept
@@ -117,6 +233,12 @@ void Flight::setStatus(const string& status) noexcept
 void Flight::setPrice(double price) noexcept
 {
 	this->price = price;
+	
+	// A single-cabin flight has only the lead-in fare
+	if (fareBuckets.size() == 1)
+	{
+		fareBuckets.front().price = price;
+	}
 }
 
 void Flight::setGate(const string& gate) noexcept
@@ -149,64 +271,91 @@ void Flight::setArrivalDateTime(const string& arrivalDateTime) noexcept
 	this->arrivalDateTime = arrivalDateTime;
 }
 
-void Flight::setAircraftType(const string& aircraftType) noexcept
+void Flight::setAircraftType(const string& aircraftType)
 {
 	this->aircraftType = aircraftType;
+	
+	// Seat indexes are tied to the aircraft layout; re-sized on next reservation
+	seatOccupancy = SeatBitset();
+	
+	// Fares carry over by cabin name; nothing is sold on the new aircraft yet
+	for (FareBucket& bucket : fareBuckets)
+	{
+		bucket.sold = 0;
+		bucket.firstRow = 0;
+		bucket.lastRow = 0;
+	}
+	alignFareBuckets();
 }
 
 // ==================== Seat Management ====================
 
-bool Flight::reserveSeat(const string& seatNumber)
+int Flight::getSeatIndex(const string& seatNumber) const
 {
-	// Check if seat already reserved
-	if (!isSeatAvailable(seatNumber))
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	if (!config)
 	{
-		throw FlightException("Seat " + seatNumber + " is already reserved.");
+		throw FlightException("Invalid or missing aircraft type.");
 	}
 	
+	return SeatMap::seatToIndex(seatNumber, *config->layout, config->rows);
+}
+
+bool Flight::reserveSeat(const string& seatNumber)
+{
 	// Check if seat is valid for this aircraft
-	try
+	int seatIndex = getSeatIndex(seatNumber);
+	if (seatIndex < 0)
 	{
-		shared_ptr<Aircraft> aircraft = AircraftManager::getInstance()->getAircraft(aircraftType);
-		if (!aircraft)
-		{
-			throw FlightException("Invalid or missing aircraft type.");
-		}
-		
-		string seatLayout = aircraft->getSeatLayout();
-		int rows = aircraft->getRows();
-		SeatMap seatMap(seatLayout, rows);
-		
-		if (!seatMap.isValidSeat(seatNumber))
-		{
-			throw FlightException("Seat " + seatNumber + " is invalid for this aircraft.");
-		}
+		throw FlightException("Seat " + seatNumber + " is invalid for this aircraft.");
 	}
-	catch (const SeatMapException& e)
+	
+	int totalSeats = getTotalSeats();
+	if (seatOccupancy.size() != totalSeats)
+	{
+		seatOccupancy.resize(totalSeats);
+	}
+	
+	// Check if seat already reserved
+	if (!seatOccupancy.set(seatIndex))
 	{
-		throw FlightException("Seat operation failed." + string(e.what()));
+		throw FlightException("Seat " + seatNumber + " is already reserved.");
 	}
 	
-	reservedSeats.push_back(seatNumber);
+	adjustSoldCount(seatIndex, 1);
 	return true;
 }
 
 bool Flight::releaseSeat(const string& seatNumber)
 {
-	auto it = std::find(reservedSeats.begin(), reservedSeats.end(), seatNumber);
-	
-	if (it != reservedSeats.end())
+	try
 	{
-		reservedSeats.erase(it);
+		int seatIndex = getSeatIndex(seatNumber);
+		if (!seatOccupancy.reset(seatIndex))
+		{
+			return false;
+		}
+		
+		adjustSoldCount(seatIndex, -1);
 		return true;
 	}
-	
-	return false;
+	catch (const FlightException&)
+	{
+		return false;
+	}
 }
 
 bool Flight::isSeatAvailable(const string& seatNumber) const noexcept
 {
-	return std::find(reservedSeats.begin(), reservedSeats.end(), seatNumber) == reservedSeats.end();
+	try
+	{
+		int seatIndex = getSeatIndex(seatNumber);
+		return seatIndex >= 0 && !seatOccupancy.test(seatIndex);
+	}
+	catch (const std::exception&)
+	{
+		return false;
+	}
 }
 
 // ==================== Crew Management Methods ====================
@@ -234,6 +383,11 @@ bool Flight::hasCrewMember(const string& crewId) const noexcept
 }
 
 double Flight::getFlightDuration() const
+{
+	return getFlightDuration(departureDateTime, arrivalDateTime);
+}
+
+double Flight::getFlightDuration(const string& departureDateTime, const string& arrivalDateTime)
 {
 	// Parse departure and arrival times to calculate duration in hours
 	// Format: "YYYY-MM-DD HH:MM"
@@ -271,6 +425,20 @@ double Flight::getFlightDuration() const
 	}
 }
 
+std::time_t Flight::parseDateTime(const string& dateTime)
+{
+	std::tm tm = {};
+	std::istringstream ss(dateTime);
+	ss >> std::get_time(&tm, "%Y-%m-%d %H:%M");
+	if (ss.fail())
+	{
+		return -1;
+	}
+	
+	tm.tm_isdst = -1;	// Let the C library decide daylight saving
+	return std::mktime(&tm);
+}
+
 // ==================== FlightException Class ====================
 
 FlightException::FlightException(const string& message) : message(message) {}
@@ -3,6 +3,7 @@
 #include <sstream>
 #include "FlightCreator.hpp"
 #include "AircraftManager.hpp"
+#include "SeatMap.hpp"
 
 // ==================== FlightValidator ====================
 
@@ -93,10 +94,24 @@ shared_ptr<Flight> FlightCreator::createNewFlight()
 		string arrivalDateTime = getValidArrivalDateTime();
 		string aircraftType = getValidAircraftType();
 		string status = "Scheduled";
-		double price = getValidPrice();
 		
-		return std::shared_ptr<Flight>(new Flight(flightNumber, origin, destination, departureDateTime, arrivalDateTime,
-						aircraftType, status, price, "N/A", "N/A"));
+		// Multi-cabin aircraft are priced per cabin; the lead-in fare is the cheapest of them
+		vector<FareBucket> fareBuckets;
+		shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+		if (config && config->cabins.size() > 1)
+		{
+			for (const CabinClass& cabin : config->cabins)
+			{
+				fareBuckets.push_back(FareBucket{cabin.name, getValidPrice(cabin.name + " "), 0});
+			}
+		}
+		double price = fareBuckets.empty() ? getValidPrice() : std::min_element(fareBuckets.begin(), fareBuckets.end(),
+			[](const FareBucket& a, const FareBucket& b) { return a.price < b.price; })->price;
+		
+		auto flight = std::shared_ptr<Flight>(new Flight(flightNumber, origin, destination, departureDateTime, arrivalDateTime,
+						aircraftType, status, price, "N/A", "N/A", SeatBitset(), {}, fareBuckets));
+		flight->alignFareBuckets();
+		return flight;
 	}
 	catch (const UIException& e)
 	{
@@ -258,13 +273,13 @@ string FlightCreator::getValidStatus()
 	}
 }
 
-double FlightCreator::getValidPrice()
+double FlightCreator::getValidPrice(const string& label)
 {
 	while (true)
 	{
 		try
 		{
-			double price = ui->getDouble("Enter Price (e.g., 299.99): ");
+			double price = ui->getDouble("Enter " + label + "Price (e.g., 299.99): ");
 			
 			if (FlightValidator::isValidPrice(price))
 				return price;
@@ -302,9 +317,16 @@ json FlightCreator::toJson(const shared_ptr<Flight>& flight)
 	flightData["price"] = flight->getPrice();
 	flightData["gate"] = flight->getGate();
 	flightData["boardingTime"] = flight->getBoardingTime();
-	flightData["reservedSeats"] = flight->getReservedSeats();
+	flightData["seatOccupancy"] = flight->getSeatOccupancy().toHex();
 	flightData["assignedCrewIds"] = flight->getAssignedCrew();
 	
+	flightData["fareBuckets"] = json::object();
+	for (const FareBucket& bucket : flight->getFareBuckets())
+	{
+		flightData["fareBuckets"][bucket.cabin] = {{"price", bucket.price}, {"sold", bucket.sold},
+		                                           {"firstRow", bucket.firstRow}, {"lastRow", bucket.lastRow}};
+	}
+	
 	return flightData;
 }
 
@@ -321,12 +343,28 @@ shared_ptr<Flight> FlightCreator::createFromJson(const string &flightNumber, con
 	string gate = data.value("gate", "N/A");
 	string boardingTime = data.value("boardingTime", "N/A");
 	
-	vector<string> reservedSeats;
-	if (data.contains("reservedSeats") && data["reservedSeats"].is_array())
+	// Seat occupancy is stored as a compact hex bitset; older entries list seat numbers
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(aircraftType);
+	SeatBitset seatOccupancy;
+	if (data.contains("seatOccupancy") && data["seatOccupancy"].is_string())
+	{
+		string hex = data["seatOccupancy"].get<string>();
+		int seatCount = config ? config->totalSeats : static_cast<int>(hex.length()) * 4;
+		seatOccupancy = SeatBitset::fromHex(hex, seatCount);
+	}
+	else if (data.contains("reservedSeats") && data["reservedSeats"].is_array())
 	{
+		// Without the layout the seat numbers cannot be placed; refuse rather than load an empty cabin
+		if (!config)
+		{
+			throw FlightException("Cannot load reserved seats of flight " + flightNumber + ": aircraft type "
+			                      + aircraftType + " is unknown.");
+		}
+		
+		seatOccupancy.resize(config->totalSeats);
 		for (const auto& seat : data["reservedSeats"])
 		{
-			reservedSeats.push_back(seat.get<string>());
+			seatOccupancy.set(SeatMap::seatToIndex(seat.get<string>(), *config->layout, config->rows));
 		}
 	}
 
@@ -338,8 +376,21 @@ shared_ptr<Flight> FlightCreator::createFromJson(const string &flightNumber, con
             assignedCrewIds.push_back(crewId.get<string>());
         }
     }
+
+	// Journaled counter updates may carry only "sold"; the lead-in fare fills any missing price
+	vector<FareBucket> fareBuckets;
+	if (data.contains("fareBuckets") && data["fareBuckets"].is_object())
+	{
+		for (const auto& [cabin, bucket] : data["fareBuckets"].items())
+		{
+			fareBuckets.push_back(FareBucket{cabin, bucket.value("price", price), bucket.value("sold", 0),
+			                                 bucket.value("firstRow", 0), bucket.value("lastRow", 0)});
+		}
+	}
 	
 	// Create and return Flight
-	return std::shared_ptr<Flight>(new Flight(flightNumber, origin, destination, departureDateTime, arrivalDateTime,
-					aircraftType, status, price, gate, boardingTime, reservedSeats, assignedCrewIds));
+	auto flight = std::shared_ptr<Flight>(new Flight(flightNumber, origin, destination, departureDateTime, arrivalDateTime,
+					aircraftType, status, price, gate, boardingTime, seatOccupancy, assignedCrewIds, fareBuckets));
+	flight->alignFareBuckets();
+	return flight;
 }
@@ -2,20 +2,29 @@
 #include <algorithm>
 #include <iomanip>
 #include "FlightManager.hpp"
+#include "AircraftManager.hpp"
+#include "SeatMap.hpp"
+#include "PricingEngine.hpp"
 #include "ReservationManager.hpp"
+#include "WaitlistManager.hpp"
+#include "CapacityManager.hpp"
 #include "Crew.hpp"
 #include "CrewManager.hpp"
+#include "JobScheduler.hpp"
 
 // Static member initialization
 FlightManager* FlightManager::instance = nullptr;
 
 // ==================== Constructor & Singleton ====================
 
-FlightManager::FlightManager()
+FlightManager::FlightManager() : holdTimers(std::chrono::seconds(1), 4096)
 {
 	db = std::make_unique<Database>("Flights");
 	ui = UserInterface::getInstance();
 	creator = std::make_unique<FlightCreator>();
+	
+	JobScheduler::getInstance()->scheduleRecurring("FlightCompletionSweep",
+		std::chrono::minutes(FLIGHT_COMPLETION_SWEEP_MINUTES), [this]() { completeArrivedFlights(); });
 }
 
 FlightManager* FlightManager::getInstance()
@@ -202,18 +211,44 @@ void FlightManager::updateFlight()
 			case 3:
 			{
 				string newStatus = selectFlightStatus();
+				if (newStatus == "Completed")
+				{
+					// Completion closes out reservations and crew too, so it goes through the pipeline
+					if (completeFlights({flight}) == 0)
+					{
+						ui->printWarning("Flight is already completed or canceled.");
+						break;
+					}
+					ui->printSuccess("Flight completed; reservations and crew hours closed out.");
+					break;
+				}
 				flight->setStatus(newStatus);
 				ui->printSuccess("Flight status updated successfully.");
 				saveFlightToDatabase(flight);
-				if (newStatus == "Arrived")
-				{
-					updateCrewFlightHours(flight);
-				}
 				break;
 			}
 			case 4:
 			{
-				double newPrice = ui->getDouble("Enter new Price: ");
+				// Multi-cabin flights are priced per fare bucket; these are base fares the PricingEngine scales
+				const vector<FareBucket>& buckets = flight->getFareBuckets();
+				if (buckets.size() > 1)
+				{
+					for (size_t i = 0; i < buckets.size(); ++i)
+					{
+						double cabinPrice = ui->getDouble("Enter new " + buckets[i].cabin + " Base Price (current " +
+						                                  ui->formatCurrency(buckets[i].price) + "): ");
+						if (cabinPrice <= 0)
+						{
+							throw FlightException("Price must be positive.");
+						}
+						flight->setCabinPrice(i, cabinPrice);
+					}
+					ui->printSuccess("Flight fares updated successfully.");
+					saveFlightToDatabase(flight);
+					break;
+				}
+				
+				double newPrice = ui->getDouble("Enter new Base Price: ");
 				if (newPrice > 0)
 				{
 					flight->setPrice(newPrice);
@@ -334,8 +369,18 @@ void FlightManager::assignCrewToFlight(const shared_ptr<Flight>& flight)
 		int roleChoice = ui->getChoice("Enter role: ", 1, static_cast<int>(roleOptions.size()));
 		CrewRole selectedRole = Crew::stringToRole(roleOptions[roleChoice - 1]);
 		
+		// Members must be off duty from CREW_MIN_REST_HOURS before departure to as long after arrival
+		auto [departure, arrival] = getDutyWindow(flight->getStatus(), flight->getDepartureDateTime(),
+		                                          flight->getArrivalDateTime());
+		std::time_t restWindowStart = 0, restWindowEnd = 0;	// Empty for a canceled or unscheduled flight
+		if (departure != -1)
+		{
+			restWindowStart = departure - CREW_MIN_REST_HOURS * 3600;
+			restWindowEnd = arrival + CREW_MIN_REST_HOURS * 3600;
+		}
+		
 		CrewManager* crewMgr = CrewManager::getInstance();
-		vector<shared_ptr<Crew>> availableCrew = crewMgr->getAvailableCrew(selectedRole);
+		vector<shared_ptr<Crew>> availableCrew = crewMgr->getAvailableCrew(selectedRole, restWindowStart, restWindowEnd);
 		crewMgr->displayCrewTable(availableCrew, "Available crew for selection");
 		
 		string crewId = ui->getString("Enter Crew ID to assign: ");
@@ -348,9 +393,28 @@ void FlightManager::assignCrewToFlight(const shared_ptr<Flight>& flight)
 			return;
 		}
 		
+		if (flight->hasCrewMember(crewId))
+		{
+			ui->printError("Crew member " + crewId + " is already assigned to this flight.");
+			ui->pauseScreen();
+			return;
+		}
+		
+		vector<string> conflicts = getCrewConflicts(crewId, restWindowStart, restWindowEnd);
+		if (!conflicts.empty())
+		{
+			string flightList;
+			for (const string& conflict : conflicts)
+			{
+				flightList += (flightList.empty() ? "" : ", ") + conflict;
+			}
+			ui->printError("Crew member " + crewId + " is on duty or resting from flight(s) " + flightList + ".");
+			ui->pauseScreen();
+			return;
+		}
+		
 		flight->addCrewMember(crewId);
 		saveFlightToDatabase(flight);
-		crewMgr->markCrewAsAssigned(crewId);
 		
 		ui->printSuccess("Crew member " + crewId + " has been assigned to flight " + flight->getFlightNumber());
 	}
@@ -393,8 +457,39 @@ void FlightManager::saveFlightToDatabase(const shared_ptr<Flight>& flight)
 	try
 	{
 		json flightData = creator->toJson(flight);
+		
+		// The seat inventory, not the loaded Flight object, is authoritative for occupancy
+		shared_ptr<SeatInventory> inventory;
+		{
+			std::shared_lock<std::shared_mutex> lock(inventoryMutex);
+			auto it = seatInventories.find(flight->getFlightNumber());
+			if (it != seatInventories.end())
+			{
+				inventory = it->second;
+			}
+		}
+		
+		if (inventory && inventory->getAircraftType() != flight->getAircraftType())
+		{
+			dropSeatInventory(flight->getFlightNumber());
+			inventory = nullptr;
+		}
+		
+		std::unique_lock<std::mutex> persistLock;
+		if (inventory)
+		{
+			persistLock = std::unique_lock<std::mutex>(inventory->getPersistMutex());
+			flightData["seatOccupancy"] = inventory->snapshot().toHex();
+			flightData["fareBuckets"].merge_patch(soldCounters(inventory));
+		}
+		
 		if (db->entryExists(flight->getFlightNumber()))
 		{
+			// Older entries stored seat numbers; occupancy now lives in "seatOccupancy"
+			if (db->attributeExists(flight->getFlightNumber(), "reservedSeats"))
+			{
+				db->deleteAttribute(flight->getFlightNumber(), "reservedSeats");
+			}
 			db->updateEntry(flight->getFlightNumber(), flightData);
 		}
 		else
@@ -406,6 +501,27 @@ void FlightManager::saveFlightToDatabase(const shared_ptr<Flight>& flight)
 	{
 		throw FlightException("An error occurred while accessing the database." + string(e.what()));
 	}
+	
+	PricingEngine::getInstance()->invalidate(flight->getFlightNumber());
+	
+	{
+		std::lock_guard<std::mutex> lock(flightIndexMutex);
+		if (flightIndexesBuilt)
+		{
+			indexFlightCrew(flight->getFlightNumber(), flight->getAssignedCrew(),
+			                getDutyWindow(flight->getStatus(), flight->getDepartureDateTime(), flight->getArrivalDateTime()));
+			indexFlightAircraft(flight->getFlightNumber(), flight->getAircraftType());
+		}
+	}
+	
+	// Counted once; later saves of a departed flight are no-ops
+	CapacityManager::getInstance()->recordDeparture(flight);
+	
+	std::lock_guard<std::mutex> lock(arrivalMutex);
+	if (arrivalQueueBuilt)
+	{
+		scheduleArrival(flight);
+	}
 }
 
 void FlightManager::deleteFlightFromDatabase(const string& flightNumber)
@@ -413,6 +529,20 @@ void FlightManager::deleteFlightFromDatabase(const string& flightNumber)
 	try
 	{
 		db->deleteEntry(flightNumber);
+		dropSeatInventory(flightNumber);
+		
+		{
+			std::lock_guard<std::mutex> lock(flightIndexMutex);
+			if (flightIndexesBuilt)
+			{
+				indexFlightCrew(flightNumber, {});
+				crewByFlight.erase(flightNumber);
+				indexFlightAircraft(flightNumber, "");
+			}
+		}
+		
+		std::lock_guard<std::mutex> lock(arrivalMutex);
+		unscheduleArrival(flightNumber);
 	}
 	catch (const DatabaseException& e)
 	{
@@ -535,7 +665,7 @@ void FlightManager::updateFlightDetails(const shared_ptr<Flight>& flight)
 				break;
 		}
 	}
-	catch (const FlightException& e)
+	catch (const std::exception& e)
 	{
 		ui->printError(string(e.what()));
 	}
@@ -551,6 +681,7 @@ string FlightManager::selectFlightStatus()
 		"Boarding",
 		"Departed",
 		"Arrived",
+		"Completed",
 		"Canceled"
 	};
 	
@@ -568,6 +699,22 @@ string FlightManager::selectFlightStatus()
 	}
 }
 
+string FlightManager::formatCabinAvailability(const shared_ptr<Flight>& flight)
+{
+	// Straight from the fare bucket counters; no seat list is built
+	string result;
+	const vector<FareBucket>& buckets = flight->getFareBuckets();
+	for (size_t i = 0; i < buckets.size(); ++i)
+	{
+		if (!result.empty())
+		{
+			result += ", ";
+		}
+		result += buckets[i].cabin + " " + std::to_string(flight->getCabinAvailableSeats(i));
+	}
+	return result;
+}
+
 void FlightManager::displayFlightsTable(const vector<shared_ptr<Flight>>& flights, const string& title)
 {
 	if (flights.empty())
@@ -577,7 +724,7 @@ void FlightManager::displayFlightsTable(const vector<shared_ptr<Flight>>& flight
 	}
 	
 	vector<string> headers = {
-		"Flight Number", "Origin", "Destination", "Departure", "Status", "Total Seats", "Available", "Price"
+		"Flight Number", "Origin", "Destination", "Departure", "Status", "Total Seats", "Available", "Cabins", "Price"
 	};
 	
 	vector<vector<string>> rows;
@@ -596,7 +743,8 @@ void FlightManager::displayFlightsTable(const vector<shared_ptr<Flight>>& flight
 					flight->getStatus(),
 					std::to_string(flight->getTotalSeats()),
 					std::to_string(flight->getAvailableSeats()),
-					ui->formatCurrency(flight->getPrice())
+					formatCabinAvailability(flight),
+					ui->formatCurrency(PricingEngine::getInstance()->quoteLeadIn(flight))
 				});
 			}
 			catch (const std::exception& e)
@@ -622,16 +770,175 @@ void FlightManager::displayFlightsTable(const vector<shared_ptr<Flight>>& flight
 	ui->displayTable(headers, rows);
 }
 
-void FlightManager::updateCrewFlightHours(const shared_ptr<Flight>& flight)
+void FlightManager::buildFlightIndexes()
+{
+	if (flightIndexesBuilt)
+	{
+		return;
+	}
+	
+	// Straight from the raw records; no Flight objects are built
+	json allFlightsData = db->loadAll();
+	vector<std::tuple<string, std::time_t, std::time_t>> crewed;
+	for (const auto& [flightNumber, flightData] : allFlightsData.items())
+	{
+		vector<string> crewIds = flightData.value("assignedCrewIds", vector<string>());
+		std::pair<std::time_t, std::time_t> dutyWindow = getDutyWindow(flightData.value("status", ""),
+			flightData.value("departureDateTime", ""), flightData.value("arrivalDateTime", ""));
+		if (!crewIds.empty() && dutyWindow.first != -1)
+		{
+			crewed.emplace_back(flightNumber, dutyWindow.first, dutyWindow.second);
+		}
+		indexFlightCrew(flightNumber, crewIds, dutyWindow);
+		indexFlightAircraft(flightNumber, flightData.value("aircraftType", ""));
+	}
+	crewedDuties.assign(std::move(crewed));
+	flightIndexesBuilt = true;
+}
+
+void FlightManager::indexFlightCrew(const string& flightNumber, const vector<string>& crewIds,
+                                    std::pair<std::time_t, std::time_t> dutyWindow)
+{
+	vector<string>& previous = crewByFlight[flightNumber];
+	for (const string& crewId : previous)
+	{
+		if (std::find(crewIds.begin(), crewIds.end(), crewId) != crewIds.end())
+			continue;
+		
+		auto it = flightsByCrew.find(crewId);
+		if (it != flightsByCrew.end())
+		{
+			it->second.erase(flightNumber);
+			if (it->second.empty())
+				flightsByCrew.erase(it);
+		}
+		
+		auto duties = dutiesByCrew.find(crewId);
+		if (duties != dutiesByCrew.end() && duties->second.erase(flightNumber) && duties->second.empty())
+		{
+			dutiesByCrew.erase(duties);
+		}
+	}
+	
+	// Inserting replaces the flight's previous window, so rescheduling moves it in every tree
+	for (const string& crewId : crewIds)
+	{
+		flightsByCrew[crewId].insert(flightNumber);
+		if (dutyWindow.first != -1)
+		{
+			dutiesByCrew[crewId].insert(flightNumber, dutyWindow.first, dutyWindow.second);
+		}
+		else
+		{
+			auto duties = dutiesByCrew.find(crewId);
+			if (duties != dutiesByCrew.end() && duties->second.erase(flightNumber) && duties->second.empty())
+			{
+				dutiesByCrew.erase(duties);
+			}
+		}
+	}
+	previous = crewIds;
+	
+	// The build loads every window at once instead
+	if (flightIndexesBuilt)
+	{
+		if (!crewIds.empty() && dutyWindow.first != -1)
+			crewedDuties.insert(flightNumber, dutyWindow.first, dutyWindow.second);
+		else
+			crewedDuties.erase(flightNumber);
+	}
+}
+
+void FlightManager::indexFlightAircraft(const string& flightNumber, const string& aircraftType)
+{
+	auto previous = aircraftTypeByFlight.find(flightNumber);
+	if (previous != aircraftTypeByFlight.end())
+	{
+		if (previous->second == aircraftType)
+		{
+			return;
+		}
+		
+		auto it = flightsByAircraftType.find(previous->second);
+		if (it != flightsByAircraftType.end())
+		{
+			it->second.erase(flightNumber);
+			if (it->second.empty())
+				flightsByAircraftType.erase(it);
+		}
+		aircraftTypeByFlight.erase(previous);
+	}
+	
+	if (!aircraftType.empty())
+	{
+		flightsByAircraftType[aircraftType].insert(flightNumber);
+		aircraftTypeByFlight[flightNumber] = aircraftType;
+	}
+}
+
+std::pair<std::time_t, std::time_t> FlightManager::getDutyWindow(const string& status, const string& departure,
+                                                                 const string& arrival)
+{
+	std::time_t start = Flight::parseDateTime(departure);
+	if (status == "Canceled" || start == -1)
+	{
+		return {-1, -1};
+	}
+	
+	// Same fallback as toRosterFlight, so the interval tree and the roster solver agree
+	std::time_t end = Flight::parseDateTime(arrival);
+	if (end <= start)
+	{
+		end = start + static_cast<std::time_t>(Flight::getFlightDuration(departure, arrival) * 3600);
+	}
+	if (end <= start)
+	{
+		return {-1, -1};
+	}
+	return {start, end};
+}
+
+void FlightManager::buildArrivalQueue()
+{
+	if (arrivalQueueBuilt)
+	{
+		return;
+	}
+	
+	for (const auto& flight : getAllFlights())
+	{
+		scheduleArrival(flight);
+	}
+	arrivalQueueBuilt = true;
+}
+
+void FlightManager::scheduleArrival(const shared_ptr<Flight>& flight)
+{
+	if (!flight)
+	{
+		return;
+	}
+	
+	unscheduleArrival(flight->getFlightNumber());
+	
+	string status = flight->getStatus();
+	std::time_t arrival = Flight::parseDateTime(flight->getArrivalDateTime());
+	if (status == "Completed" || status == "Canceled" || arrival == -1)
+	{
+		return;
+	}
+	
+	arrivalEntries[flight->getFlightNumber()] = arrivalQueue.emplace(arrival, flight->getFlightNumber());
+}
+
+void FlightManager::unscheduleArrival(const string& flightNumber)
 {
-	double flightDuration = flight->getFlightDuration();
-    vector<string> crewIds = flight->getAssignedCrew();
-    
-    for (const string& crewId : crewIds)
-    {
-        CrewManager::getInstance()->addFlightHoursForCrew(crewId, flightDuration);
-        CrewManager::getInstance()->markCrewAsAvailable(crewId);
-    }
+	auto it = arrivalEntries.find(flightNumber);
+	if (it != arrivalEntries.end())
+	{
+		arrivalQueue.erase(it->second);
+		arrivalEntries.erase(it);
+	}
 }
 
 // ==================== Query Methods ====================
@@ -735,6 +1042,65 @@ bool FlightManager::flightExists(const string& flightNumber)
 	}
 }
 
+vector<string> FlightManager::getFlightsForCrew(const string& crewId)
+{
+	std::lock_guard<std::mutex> lock(flightIndexMutex);
+	buildFlightIndexes();
+	
+	auto it = flightsByCrew.find(crewId);
+	return it != flightsByCrew.end() ? vector<string>(it->second.begin(), it->second.end()) : vector<string>();
+}
+
+vector<string> FlightManager::getFlightsByAircraftType(const string& aircraftType)
+{
+	std::lock_guard<std::mutex> lock(flightIndexMutex);
+	buildFlightIndexes();
+	
+	auto it = flightsByAircraftType.find(aircraftType);
+	return it != flightsByAircraftType.end() ? vector<string>(it->second.begin(), it->second.end()) : vector<string>();
+}
+
+bool FlightManager::isAircraftTypeInUse(const string& aircraftType)
+{
+	std::lock_guard<std::mutex> lock(flightIndexMutex);
+	buildFlightIndexes();
+	
+	return flightsByAircraftType.find(aircraftType) != flightsByAircraftType.end();
+}
+
+bool FlightManager::isCrewFree(const string& crewId, std::time_t start, std::time_t end)
+{
+	std::lock_guard<std::mutex> lock(flightIndexMutex);
+	buildFlightIndexes();
+	
+	auto it = dutiesByCrew.find(crewId);
+	return it == dutiesByCrew.end() || !it->second.overlaps(start, end);
+}
+
+vector<string> FlightManager::getCrewConflicts(const string& crewId, std::time_t start, std::time_t end)
+{
+	std::lock_guard<std::mutex> lock(flightIndexMutex);
+	buildFlightIndexes();
+	
+	auto it = dutiesByCrew.find(crewId);
+	return it != dutiesByCrew.end() ? it->second.findOverlapping(start, end) : vector<string>();
+}
+
+std::unordered_set<string> FlightManager::getBusyCrew(std::time_t start, std::time_t end)
+{
+	std::lock_guard<std::mutex> lock(flightIndexMutex);
+	buildFlightIndexes();
+	
+	std::unordered_set<string> busy;
+	for (const string& flightNumber : crewedDuties.findOverlapping(start, end))
+	{
+		auto it = crewByFlight.find(flightNumber);
+		if (it != crewByFlight.end())
+			busy.insert(it->second.begin(), it->second.end());
+	}
+	return busy;
+}
+
 bool FlightManager::hasActiveReservations(const string& flightNumber)
 {
 	return ReservationManager::hasActiveReservations(flightNumber);
@@ -742,24 +1108,45 @@ bool FlightManager::hasActiveReservations(const string& flightNumber)
 
 bool FlightManager::reserveSeatForFlight(const string& flightNumber, const string& seatNumber)
 {
+	return reserveSeatsForFlight(flightNumber, {seatNumber});
+}
+
+bool FlightManager::reserveSeatsForFlight(const string& flightNumber, const vector<string>& seatNumbers)
+{
+	expireSeatHolds();
+	
 	try
 	{
-		shared_ptr<Flight> flight = loadFlightFromDatabase(flightNumber);
-		if (!flight)
+		shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+		vector<int> seatIndexes = resolveSeatIndexes(inventory, seatNumbers);
+		
+		// All or nothing: exactly one concurrent caller wins the compare-and-swap for a given seat
+		for (size_t i = 0; i < seatIndexes.size(); ++i)
 		{
-			throw FlightException("Flight does not exist.");
+			if (!inventory->tryReserve(seatIndexes[i]))
+			{
+				for (size_t j = 0; j < i; ++j)
+				{
+					inventory->release(seatIndexes[j]);
+				}
+				throw FlightException("Seat " + seatNumbers[i] + " is already reserved.");
+			}
 		}
 		
-		// Reserve the seat (this will throw if seat is invalid or already reserved)
-		bool success = flight->reserveSeat(seatNumber);
-		
-		if (success)
+		try
 		{
-			// Persist the change to database
-			saveFlightToDatabase(flight);
+			persistSeatInventory(flightNumber, inventory);
+		}
+		catch (const std::exception& e)
+		{
+			for (int seatIndex : seatIndexes)
+			{
+				inventory->release(seatIndex);
+			}
+			throw;
 		}
 		
-		return success;
+		return true;
 	}
 	catch (const std::exception& e)
 	{
@@ -768,30 +1155,796 @@ bool FlightManager::reserveSeatForFlight(const string& flightNumber, const strin
 	}
 }
 
+bool FlightManager::handOverReleasedSeat(const string& flightNumber, const string& seatNumber)
+{
+	try
+	{
+		if (ReservationManager::getInstance()->seatOverbookedPassenger(flightNumber, seatNumber))
+		{
+			return true;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		// Fall through to the waitlist; the overbooked passenger is seated at check-in instead
+		ui->printError("Could not seat overbooked passenger: " + string(e.what()));
+	}
+	
+	return WaitlistManager::getInstance()->promoteNext(flightNumber, seatNumber);
+}
+
 bool FlightManager::releaseSeatForFlight(const string& flightNumber, const string& seatNumber)
 {
 	try
 	{
-		shared_ptr<Flight> flight = loadFlightFromDatabase(flightNumber);
-		if (!flight)
+		shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+		
+		int seatIndex = inventory->getSeatIndex(seatNumber);
+		if (seatIndex < 0 || inventory->getState(seatIndex) != SeatInventory::SeatState::RESERVED)
+		{
+			return false;
+		}
+		
+		// Confirmed overbooked passengers, then the waitlist, take over a seat in the cabin they paid
+		// for directly, so it never returns to the pool; any other seat is released
+		if (handOverReleasedSeat(flightNumber, seatNumber))
 		{
-			throw FlightException("Flight does not exist.");
+			return true;
 		}
 		
-		// Release the seat
-		bool success = flight->releaseSeat(seatNumber);
+		if (!inventory->release(seatIndex))
+		{
+			return false;
+		}
 		
-		if (success)
+		try
+		{
+			persistSeatInventory(flightNumber, inventory);
+		}
+		catch (const std::exception& e)
 		{
-			// Persist the change to database
-			saveFlightToDatabase(flight);
+			inventory->tryReserve(seatIndex);
+			throw;
 		}
 		
-		return success;
+		return true;
 	}
 	catch (const std::exception& e)
 	{
 		ui->printError(string(e.what()));
 		return false;
 	}
-}
\ No newline at end of file
+}
+
+vector<bool> FlightManager::reserveAvailableSeats(const string& flightNumber, const vector<string>& seatNumbers)
+{
+	vector<bool> reserved(seatNumbers.size(), false);
+	
+	try
+	{
+		shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+		
+		vector<int> reservedIndexes;
+		for (size_t i = 0; i < seatNumbers.size(); ++i)
+		{
+			int seatIndex = inventory->getSeatIndex(seatNumbers[i]);
+			if (seatIndex >= 0 && inventory->tryReserve(seatIndex))
+			{
+				reserved[i] = true;
+				reservedIndexes.push_back(seatIndex);
+			}
+		}
+		
+		if (reservedIndexes.empty())
+		{
+			return reserved;
+		}
+		
+		try
+		{
+			persistSeatInventory(flightNumber, inventory);
+		}
+		catch (const std::exception& e)
+		{
+			for (int seatIndex : reservedIndexes)
+			{
+				inventory->release(seatIndex);
+			}
+			throw;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError(string(e.what()));
+		std::fill(reserved.begin(), reserved.end(), false);
+	}
+	
+	return reserved;
+}
+
+void FlightManager::releaseSeatsForFlight(const string& flightNumber, const vector<string>& seatNumbers)
+{
+	try
+	{
+		shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+		
+		vector<int> releasedIndexes;
+		for (const string& seatNumber : seatNumbers)
+		{
+			int seatIndex = inventory->getSeatIndex(seatNumber);
+			if (inventory->release(seatIndex))
+			{
+				releasedIndexes.push_back(seatIndex);
+			}
+		}
+		
+		if (releasedIndexes.empty())
+		{
+			return;
+		}
+		
+		try
+		{
+			persistSeatInventory(flightNumber, inventory);
+		}
+		catch (const std::exception& e)
+		{
+			for (int seatIndex : releasedIndexes)
+			{
+				inventory->tryReserve(seatIndex);
+			}
+			throw;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError(string(e.what()));
+	}
+}
+
+uint64_t FlightManager::holdSeatForFlight(const string& flightNumber, const string& seatNumber)
+{
+	vector<uint64_t> holdIds = holdSeatsForFlight(flightNumber, {seatNumber});
+	return holdIds.empty() ? 0 : holdIds.front();
+}
+
+vector<uint64_t> FlightManager::holdSeatsForFlight(const string& flightNumber, const vector<string>& seatNumbers)
+{
+	vector<uint64_t> holdIds;
+	
+	try
+	{
+		shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+		vector<int> seatIndexes = resolveSeatIndexes(inventory, seatNumbers);
+		
+		std::lock_guard<std::mutex> lock(holdMutex);
+		releaseExpiredHolds();
+		
+		// All or nothing: undo the holds already placed if any seat is taken
+		for (size_t i = 0; i < seatIndexes.size(); ++i)
+		{
+			if (!inventory->tryHold(seatIndexes[i]))
+			{
+				for (size_t j = 0; j < i; ++j)
+				{
+					inventory->releaseHold(seatIndexes[j]);
+				}
+				return holdIds;
+			}
+		}
+		
+		for (int seatIndex : seatIndexes)
+		{
+			uint64_t holdId = holdTimers.schedule(std::chrono::minutes(SEAT_HOLD_MINUTES));
+			seatHolds[holdId] = SeatHold{flightNumber, seatIndex, inventory};
+			holdIds.push_back(holdId);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError(string(e.what()));
+		holdIds.clear();
+	}
+	
+	return holdIds;
+}
+
+bool FlightManager::commitSeatHold(uint64_t holdId)
+{
+	return commitSeatHolds({holdId});
+}
+
+bool FlightManager::commitSeatHolds(const vector<uint64_t>& holdIds)
+{
+	vector<std::pair<shared_ptr<SeatInventory>, int>> committed;
+	
+	try
+	{
+		vector<SeatHold> holds;
+		{
+			std::lock_guard<std::mutex> lock(holdMutex);
+			releaseExpiredHolds();
+			
+			for (uint64_t holdId : holdIds)
+			{
+				if (seatHolds.find(holdId) == seatHolds.end())
+				{
+					throw FlightException("Seat hold has expired. Please select the seat again.");
+				}
+			}
+			
+			// Once out of the map the holds can no longer expire underneath us
+			for (uint64_t holdId : holdIds)
+			{
+				auto it = seatHolds.find(holdId);
+				holds.push_back(it->second);
+				holdTimers.cancel(holdId);
+				seatHolds.erase(it);
+			}
+		}
+		
+		std::map<string, shared_ptr<SeatInventory>> touched;
+		for (size_t i = 0; i < holds.size(); ++i)
+		{
+			// The inventory may have been rebuilt since the hold was placed
+			shared_ptr<SeatInventory> inventory = getSeatInventory(holds[i].flightNumber);
+			bool success;
+			if (inventory == holds[i].inventory)
+			{
+				success = inventory->commitHold(holds[i].seatIndex);
+			}
+			else
+			{
+				holds[i].inventory->releaseHold(holds[i].seatIndex);
+				success = inventory->tryReserve(holds[i].seatIndex);
+			}
+			
+			if (!success)
+			{
+				for (size_t j = i + 1; j < holds.size(); ++j)
+				{
+					holds[j].inventory->releaseHold(holds[j].seatIndex);
+				}
+				throw FlightException("Seat is no longer available.");
+			}
+			
+			committed.emplace_back(inventory, holds[i].seatIndex);
+			touched[holds[i].flightNumber] = inventory;
+		}
+		
+		// One journal record for every flight, so a multi-flight commit persists all or nothing
+		persistSeatInventories(touched);
+		
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		for (const auto& [inventory, seatIndex] : committed)
+		{
+			inventory->release(seatIndex);
+		}
+		ui->printError(string(e.what()));
+		return false;
+	}
+}
+
+void FlightManager::releaseSeatHold(uint64_t holdId)
+{
+	releaseSeatHolds({holdId});
+}
+
+void FlightManager::releaseSeatHolds(const vector<uint64_t>& holdIds)
+{
+	std::lock_guard<std::mutex> lock(holdMutex);
+	
+	for (uint64_t holdId : holdIds)
+	{
+		auto it = seatHolds.find(holdId);
+		if (it == seatHolds.end())
+		{
+			continue;
+		}
+		
+		it->second.inventory->releaseHold(it->second.seatIndex);
+		holdTimers.cancel(holdId);
+		seatHolds.erase(it);
+	}
+}
+
+vector<string> FlightManager::findGroupSeats(const string& flightNumber, const SeatPreferences& preferences,
+                                             const vector<string>& excludedSeats)
+{
+	expireSeatHolds();
+	
+	vector<string> seatNumbers;
+	shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+	
+	SeatBitset occupied = inventory->occupiedSnapshot();
+	for (const string& seatNumber : excludedSeats)
+	{
+		occupied.set(inventory->getSeatIndex(seatNumber));
+	}
+	
+	SeatAllocator allocator(inventory->getLayout(), inventory->getRows(), inventory->getRowCabins());
+	for (int seatIndex : allocator.allocate(occupied, preferences))
+	{
+		seatNumbers.push_back(SeatMap::indexToSeat(seatIndex, inventory->getLayout()));
+	}
+	
+	return seatNumbers;
+}
+
+void FlightManager::getSeatState(const string& flightNumber, SeatBitset& reservedSeats, SeatBitset& heldSeats)
+{
+	expireSeatHolds();
+	
+	shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+	reservedSeats = inventory->snapshot();
+	heldSeats = inventory->heldSnapshot();
+}
+
+int FlightManager::getAvailableSeatCount(const string& flightNumber)
+{
+	expireSeatHolds();
+	
+	shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+	return inventory->getSeatCount() - inventory->getReservedCount() - inventory->getHeldCount();
+}
+
+void FlightManager::displaySeatMap(const string& flightNumber)
+{
+	shared_ptr<Flight> flight = loadFlightFromDatabase(flightNumber);
+	if (!flight)
+	{
+		throw FlightException("Flight does not exist.");
+	}
+	
+	SeatBitset reservedSeats, heldSeats;
+	getSeatState(flightNumber, reservedSeats, heldSeats);
+	shared_ptr<SeatInventory> inventory = getSeatInventory(flightNumber);
+	
+	std::lock_guard<std::mutex> lock(seatMapMutex);
+	SeatMapView& view = seatMapViews[flightNumber];
+	
+	if (!view.seatMap || view.inventory != inventory)
+	{
+		shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(flight->getAircraftType());
+		if (!config)
+		{
+			seatMapViews.erase(flightNumber);
+			throw FlightException("Aircraft configuration not found for this flight.");
+		}
+		
+		view.inventory = inventory;
+		view.seatMap = std::make_unique<SeatMap>(config->seatLayout, config->rows, reservedSeats);
+		view.seatMap->setHeldSeats(heldSeats);
+		view.seatMap->getSeatMapDisplayData(view.rowLabels, view.gridData);
+	}
+	else
+	{
+		view.seatMap->applyOccupancy(reservedSeats, heldSeats, view.gridData);
+	}
+	
+	GridDisplayConfig config;
+	config.title = "Seat Map";
+	config.headerLines = view.seatMap->getSeatMapHeader(flightNumber, flight->getOrigin(),
+		flight->getDestination(), flight->getAircraftType());
+	config.legend = view.seatMap->getSeatMapLegend();
+	config.footerLines = view.seatMap->getSeatMapFooter();
+	
+	ui->displayGrid(view.rowLabels, view.gridData, config);
+}
+
+void FlightManager::invalidateSeatInventories(const string& aircraftType)
+{
+	// Fares are priced per cabin, so the flights' price curves go too
+	for (const string& flightNumber : getFlightsByAircraftType(aircraftType))
+	{
+		PricingEngine::getInstance()->invalidate(flightNumber);
+	}
+	
+	std::unique_lock<std::shared_mutex> lock(inventoryMutex);
+	
+	for (auto it = seatInventories.begin(); it != seatInventories.end(); )
+	{
+		if (it->second->getAircraftType() == aircraftType)
+		{
+			it = seatInventories.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+// ==================== Flight Completion ====================
+
+size_t FlightManager::completeFlights(const vector<shared_ptr<Flight>>& flights)
+{
+	vector<string> flightNumbers;
+	for (const auto& flight : flights)
+	{
+		if (flight && flight->getStatus() != "Completed" && flight->getStatus() != "Canceled")
+		{
+			flightNumbers.push_back(flight->getFlightNumber());
+		}
+	}
+	
+	if (flightNumbers.empty())
+	{
+		return 0;
+	}
+	
+	std::set<string> completing(flightNumbers.begin(), flightNumbers.end());
+	vector<CrewLedgerEntry> crewLedger;
+	for (const auto& flight : flights)
+	{
+		if (!flight || completing.find(flight->getFlightNumber()) == completing.end())
+		{
+			continue;
+		}
+		
+		double flightDuration = flight->getFlightDuration();
+		string month = flight->getDepartureDateTime().substr(0, 7);
+		for (const string& crewId : flight->getAssignedCrew())
+		{
+			// Later assignments show from the member's duties, so only leave needs keeping (applyCrewLedger does)
+			crewLedger.push_back(CrewLedgerEntry{crewId, flight->getFlightNumber(), flightDuration, month,
+			                                     CrewStatus::AVAILABLE});
+		}
+	}
+	
+	// The flight status is written last, so a failed run leaves the flights in the sweep to be
+	// retried. Every step before it is idempotent: reservations that are already COMPLETED are
+	// skipped, and crew records remember which flights they were credited for.
+	ReservationManager::getInstance()->completeReservations(flightNumbers);
+	CrewManager::getInstance()->applyCrewLedger(crewLedger);
+	
+	try
+	{
+		json updates = json::object();
+		for (const string& flightNumber : flightNumbers)
+		{
+			json flightData = db->getEntry(flightNumber);
+			flightData["status"] = "Completed";
+			updates[flightNumber] = flightData;
+		}
+		db->upsertEntries(updates);
+	}
+	catch (const DatabaseException& e)
+	{
+		throw FlightException("An error occurred while accessing the database." + string(e.what()));
+	}
+	
+	for (const auto& flight : flights)
+	{
+		if (flight && completing.find(flight->getFlightNumber()) != completing.end())
+		{
+			flight->setStatus("Completed");
+			CapacityManager::getInstance()->recordDeparture(flight);
+		}
+	}
+	
+	std::lock_guard<std::mutex> lock(arrivalMutex);
+	for (const string& flightNumber : flightNumbers)
+	{
+		unscheduleArrival(flightNumber);
+	}
+	
+	return flightNumbers.size();
+}
+
+size_t FlightManager::completeArrivedFlights()
+{
+	vector<string> dueFlights;
+	{
+		std::lock_guard<std::mutex> lock(arrivalMutex);
+		buildArrivalQueue();
+		
+		std::time_t cutoff = std::time(nullptr) - FLIGHT_COMPLETION_GRACE_MINUTES * 60;
+		for (auto it = arrivalQueue.begin(); it != arrivalQueue.end() && it->first <= cutoff; ++it)
+		{
+			dueFlights.push_back(it->second);
+		}
+	}
+	
+	vector<shared_ptr<Flight>> flights;
+	for (const string& flightNumber : dueFlights)
+	{
+		shared_ptr<Flight> flight = loadFlightFromDatabase(flightNumber);
+		if (flight && (flight->getStatus() == "Departed" || flight->getStatus() == "Arrived"))
+		{
+			flights.push_back(flight);
+		}
+		else
+		{
+			// Flights never marked as departed are checked once; saving them again re-queues them
+			std::lock_guard<std::mutex> lock(arrivalMutex);
+			unscheduleArrival(flightNumber);
+		}
+	}
+	
+	return completeFlights(flights);
+}
+
+// ==================== Crew Rostering ====================
+
+RosterResult FlightManager::rosterCrew(const string& fromDate, const string& toDate)
+{
+	// One pass over the flights yields both the window and every member's existing duties
+	vector<RosterFlight> window;
+	std::unordered_map<string, vector<RosterFlight>> commitments;
+	for (const auto& flight : getAllFlights())
+	{
+		RosterFlight rosterFlight;
+		if (!flight || flight->getStatus() == "Canceled" || !toRosterFlight(flight, rosterFlight))
+		{
+			continue;
+		}
+		
+		for (const string& crewId : rosterFlight.assignedCrew)
+		{
+			commitments[crewId].push_back(rosterFlight);
+		}
+		
+		string departureDate = flight->getDepartureDateTime().substr(0, 10);
+		if (departureDate >= fromDate && departureDate <= toDate &&
+			(flight->getStatus() == "Scheduled" || flight->getStatus() == "Delayed"))
+		{
+			window.push_back(std::move(rosterFlight));
+		}
+	}
+	
+	vector<RosterCrew> crew;
+	for (const auto& member : CrewManager::getInstance()->getAllCrew())
+	{
+		if (member && member->getStatus() != CrewStatus::ON_LEAVE)
+		{
+			crew.push_back(RosterCrew{member->getCrewId(), member->getRole(), std::move(commitments[member->getCrewId()])});
+		}
+	}
+	
+	RosterResult result = CrewRoster(std::move(window), std::move(crew)).solve();
+	applyCrewAssignments(result.assignments);
+	return result;
+}
+
+bool FlightManager::toRosterFlight(const shared_ptr<Flight>& flight, RosterFlight& rosterFlight)
+{
+	const string& departure = flight->getDepartureDateTime();
+	rosterFlight.departure = Flight::parseDateTime(departure);
+	if (rosterFlight.departure == -1)
+	{
+		return false;
+	}
+	
+	// Hours as credited on completion; the arrival stamp only bounds the duty
+	rosterFlight.flightNumber = flight->getFlightNumber();
+	rosterFlight.hours = flight->getFlightDuration();
+	rosterFlight.arrival = Flight::parseDateTime(flight->getArrivalDateTime());
+	if (rosterFlight.arrival <= rosterFlight.departure)
+	{
+		rosterFlight.arrival = rosterFlight.departure + static_cast<std::time_t>(rosterFlight.hours * 3600);
+	}
+	rosterFlight.month = std::stoi(departure.substr(0, 4)) * 12 + std::stoi(departure.substr(5, 2));
+	rosterFlight.assignedCrew = flight->getAssignedCrew();
+	return true;
+}
+
+void FlightManager::applyCrewAssignments(const vector<std::pair<string, string>>& assignments)
+{
+	if (assignments.empty())
+	{
+		return;
+	}
+	
+	json updates = json::object();
+	try
+	{
+		for (const auto& [flightNumber, crewId] : assignments)
+		{
+			if (!updates.contains(flightNumber))
+			{
+				updates[flightNumber] = db->getEntry(flightNumber);
+			}
+			updates[flightNumber]["assignedCrewIds"].push_back(crewId);
+		}
+		db->upsertEntries(updates);
+	}
+	catch (const DatabaseException& e)
+	{
+		throw FlightException("An error occurred while accessing the database." + string(e.what()));
+	}
+	
+	{
+		std::lock_guard<std::mutex> lock(flightIndexMutex);
+		if (flightIndexesBuilt)
+		{
+			for (const auto& [flightNumber, flightData] : updates.items())
+			{
+				indexFlightCrew(flightNumber, flightData["assignedCrewIds"].get<vector<string>>(),
+				                getDutyWindow(flightData.value("status", ""), flightData.value("departureDateTime", ""),
+				                              flightData.value("arrivalDateTime", "")));
+			}
+		}
+	}
+}
+
+// ==================== Seat Inventory Helpers ====================
+
+shared_ptr<SeatInventory> FlightManager::getSeatInventory(const string& flightNumber)
+{
+	{
+		std::shared_lock<std::shared_mutex> lock(inventoryMutex);
+		auto it = seatInventories.find(flightNumber);
+		if (it != seatInventories.end())
+		{
+			return it->second;
+		}
+	}
+	
+	std::unique_lock<std::shared_mutex> lock(inventoryMutex);
+	
+	// Another thread may have built it while we waited for the exclusive lock
+	auto it = seatInventories.find(flightNumber);
+	if (it != seatInventories.end())
+	{
+		return it->second;
+	}
+	
+	shared_ptr<Flight> flight = loadFlightFromDatabase(flightNumber);
+	if (!flight)
+	{
+		throw FlightException("Flight does not exist.");
+	}
+	
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(flight->getAircraftType());
+	if (!config)
+	{
+		throw FlightException("Aircraft type " + flight->getAircraftType() + " does not exist.");
+	}
+	
+	auto inventory = std::make_shared<SeatInventory>(flight->getAircraftType(), *config->layout, config->rows,
+	                                                 flight->getSeatOccupancy(), config->rowCabins);
+	seatInventories[flightNumber] = inventory;
+	return inventory;
+}
+
+vector<int> FlightManager::resolveSeatIndexes(const shared_ptr<SeatInventory>& inventory, const vector<string>& seatNumbers)
+{
+	vector<int> seatIndexes;
+	seatIndexes.reserve(seatNumbers.size());
+	
+	for (const string& seatNumber : seatNumbers)
+	{
+		int seatIndex = inventory->getSeatIndex(seatNumber);
+		if (seatIndex < 0)
+		{
+			throw FlightException("Seat " + seatNumber + " is invalid for this aircraft.");
+		}
+		seatIndexes.push_back(seatIndex);
+	}
+	
+	return seatIndexes;
+}
+
+void FlightManager::persistSeatInventory(const string& flightNumber, const shared_ptr<SeatInventory>& inventory)
+{
+	// Snapshot and append under one lock so journal records land in occupancy order
+	std::lock_guard<std::mutex> lock(inventory->getPersistMutex());
+	
+	try
+	{
+		json updates;
+		updates["seatOccupancy"] = inventory->snapshot().toHex();
+		updates["fareBuckets"] = soldCounters(inventory);
+		db->journalEntry(flightNumber, updates);
+		
+		// Still under the persist lock, so fares follow loads in the order they were written
+		PricingEngine::getInstance()->recordLoad(flightNumber, *inventory);
+	}
+	catch (const DatabaseException& e)
+	{
+		throw FlightException("An error occurred while accessing the database." + string(e.what()));
+	}
+}
+
+void FlightManager::persistSeatInventories(const std::map<string, shared_ptr<SeatInventory>>& inventories)
+{
+	if (inventories.size() == 1)
+	{
+		persistSeatInventory(inventories.begin()->first, inventories.begin()->second);
+		return;
+	}
+	
+	// Persist locks are taken in flight-number order, so two multi-flight commits cannot deadlock
+	vector<std::unique_lock<std::mutex>> locks;
+	json updatesByFlight = json::object();
+	for (const auto& [flightNumber, inventory] : inventories)
+	{
+		locks.emplace_back(inventory->getPersistMutex());
+		updatesByFlight[flightNumber]["seatOccupancy"] = inventory->snapshot().toHex();
+		updatesByFlight[flightNumber]["fareBuckets"] = soldCounters(inventory);
+	}
+	
+	try
+	{
+		db->journalEntries(updatesByFlight);
+	}
+	catch (const DatabaseException& e)
+	{
+		throw FlightException("An error occurred while accessing the database." + string(e.what()));
+	}
+	
+	for (const auto& [flightNumber, inventory] : inventories)
+	{
+		PricingEngine::getInstance()->recordLoad(flightNumber, *inventory);
+	}
+}
+
+json FlightManager::soldCounters(const shared_ptr<SeatInventory>& inventory)
+{
+	// Shaped as a merge patch over "fareBuckets" so journal records leave fares untouched
+	json counters = json::object();
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(inventory->getAircraftType());
+	if (!config)
+	{
+		return counters;
+	}
+	
+	// Rows come from the inventory that did the counting, so a load can tell whether they still hold
+	const vector<int>& rowCabins = inventory->getRowCabins();
+	for (size_t i = 0; i < config->cabins.size(); ++i)
+	{
+		json& counter = counters[config->cabins[i].name];
+		counter["sold"] = inventory->getCabinReservedCount(static_cast<int>(i));
+		counter["firstRow"] = 0;
+		counter["lastRow"] = 0;
+		for (int row = 1; row <= static_cast<int>(rowCabins.size()); ++row)
+		{
+			if (rowCabins[row - 1] != static_cast<int>(i))
+				continue;
+			if (counter["firstRow"] == 0)
+				counter["firstRow"] = row;
+			counter["lastRow"] = row;
+		}
+	}
+	return counters;
+}
+
+void FlightManager::dropSeatInventory(const string& flightNumber)
+{
+	{
+		std::unique_lock<std::shared_mutex> lock(inventoryMutex);
+		seatInventories.erase(flightNumber);
+	}
+	
+	PricingEngine::getInstance()->invalidate(flightNumber);
+	
+	std::lock_guard<std::mutex> lock(seatMapMutex);
+	seatMapViews.erase(flightNumber);
+}
+
+void FlightManager::expireSeatHolds()
+{
+	// Opportunistic: if another caller is already expiring holds, don't wait for it
+	std::unique_lock<std::mutex> lock(holdMutex, std::try_to_lock);
+	if (lock.owns_lock())
+	{
+		releaseExpiredHolds();
+	}
+}
+
+void FlightManager::releaseExpiredHolds()
+{
+	for (uint64_t holdId : holdTimers.advance())
+	{
+		auto it = seatHolds.find(holdId);
+		if (it != seatHolds.end())
+		{
+			it->second.inventory->releaseHold(it->second.seatIndex);
+			seatHolds.erase(it);
+		}
+	}
+}
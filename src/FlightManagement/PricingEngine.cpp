@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "PricingEngine.hpp"
+#include "AircraftManager.hpp"
+
+// Static member initialization
+PricingEngine* PricingEngine::instance = nullptr;
+
+// ==================== Singleton ====================
+
+PricingEngine* PricingEngine::getInstance()
+{
+	if (instance == nullptr)
+	{
+		instance = new PricingEngine();
+	}
+	return instance;
+}
+
+// ==================== Quotes ====================
+
+double PricingEngine::quoteCabin(const shared_ptr<Flight>& flight, int cabinIndex)
+{
+	if (!flight)
+	{
+		throw FlightException("Flight not found.");
+	}
+	
+	std::time_t now = std::time(nullptr);
+	{
+		std::shared_lock<std::shared_mutex> lock(mutex);
+		auto it = curves.find(flight->getFlightNumber());
+		if (it != curves.end() && now < it->second.validUntil)
+		{
+			return fareAt(it->second, cabinIndex);
+		}
+	}
+	
+	// First quote for the flight, or it just entered a new advance-purchase tier
+	std::unique_lock<std::shared_mutex> lock(mutex);
+	auto it = curves.find(flight->getFlightNumber());
+	if (it != curves.end() && now < it->second.validUntil)
+	{
+		return fareAt(it->second, cabinIndex);
+	}
+	
+	PriceCurve curve;
+	if (!buildCurve(flight, now, curve))
+	{
+		// No aircraft configuration to price against; fall back to the stored fares
+		return cabinIndex >= 0 && cabinIndex < static_cast<int>(flight->getFareBuckets().size())
+			? flight->getFareBuckets()[cabinIndex].price : flight->getPrice();
+	}
+	
+	// Loads recorded since the curve was first built outrank the flight's persisted counters
+	if (it != curves.end() && it->second.sold.size() == curve.sold.size())
+	{
+		for (size_t i = 0; i < curve.sold.size(); ++i)
+		{
+			applyLoad(curve, i, it->second.sold[i]);
+		}
+	}
+	
+	PriceCurve& stored = curves[flight->getFlightNumber()] = std::move(curve);
+	return fareAt(stored, cabinIndex);
+}
+
+double PricingEngine::quoteSeat(const shared_ptr<Flight>& flight, const string& seatNumber)
+{
+	return quoteCabin(flight, flight ? flight->getSeatCabin(seatNumber) : -1);
+}
+
+double PricingEngine::quoteLeadIn(const shared_ptr<Flight>& flight)
+{
+	return quoteCabin(flight, -1);
+}
+
+int PricingEngine::getLeadInCabin(const shared_ptr<Flight>& flight)
+{
+	// Builds or refreshes the curve (and validates the flight) exactly as a single quote would
+	quoteLeadIn(flight);
+	
+	{
+		std::shared_lock<std::shared_mutex> lock(mutex);
+		auto it = curves.find(flight->getFlightNumber());
+		if (it != curves.end())
+		{
+			return it->second.leadInCabin;
+		}
+	}
+	
+	// No curve; stored fares decide
+	const vector<FareBucket>& buckets = flight->getFareBuckets();
+	auto cheapest = std::min_element(buckets.begin(), buckets.end(),
+		[](const FareBucket& a, const FareBucket& b) { return a.price < b.price; });
+	return cheapest == buckets.end() ? -1 : static_cast<int>(cheapest - buckets.begin());
+}
+
+vector<double> PricingEngine::quoteSeats(const shared_ptr<Flight>& flight, const vector<string>& seatNumbers)
+{
+	vector<int> cabins;
+	cabins.reserve(seatNumbers.size());
+	for (const string& seatNumber : seatNumbers)
+	{
+		cabins.push_back(flight ? flight->getSeatCabin(seatNumber) : -1);
+	}
+	
+	// Builds or refreshes the curve (and validates the flight) exactly as a single quote would
+	double leadIn = quoteLeadIn(flight);
+	
+	vector<double> fares;
+	fares.reserve(seatNumbers.size());
+	std::shared_lock<std::shared_mutex> lock(mutex);
+	auto it = curves.find(flight->getFlightNumber());
+	if (it == curves.end())
+	{
+		// No curve to walk up; stored fares do not move with load
+		for (int cabinIndex : cabins)
+		{
+			fares.push_back(cabinIndex >= 0 && cabinIndex < static_cast<int>(flight->getFareBuckets().size())
+				? flight->getFareBuckets()[cabinIndex].price : leadIn);
+		}
+		return fares;
+	}
+	
+	const PriceCurve& curve = it->second;
+	vector<int> sold = curve.sold;
+	for (int cabinIndex : cabins)
+	{
+		if (cabinIndex < 0 || cabinIndex >= static_cast<int>(sold.size()))
+		{
+			fares.push_back(curve.leadInFare);
+			continue;
+		}
+		
+		const vector<double>& cabinFares = curve.faresBySold[cabinIndex];
+		fares.push_back(cabinFares[std::clamp(sold[cabinIndex], 0, static_cast<int>(cabinFares.size()) - 1)]);
+		++sold[cabinIndex];
+	}
+	return fares;
+}
+
+// ==================== Re-evaluation ====================
+
+void PricingEngine::recordLoad(const string& flightNumber, const SeatInventory& inventory)
+{
+	std::unique_lock<std::shared_mutex> lock(mutex);
+	
+	auto it = curves.find(flightNumber);
+	if (it == curves.end())
+	{
+		return;		// Not quoted yet; the first quote reads the persisted counters
+	}
+	
+	PriceCurve& curve = it->second;
+	if (static_cast<int>(curve.sold.size()) != inventory.getCabinCount())
+	{
+		curves.erase(it);
+		return;
+	}
+	
+	for (size_t i = 0; i < curve.sold.size(); ++i)
+	{
+		applyLoad(curve, i, inventory.getCabinReservedCount(static_cast<int>(i)));
+	}
+}
+
+void PricingEngine::invalidate(const string& flightNumber)
+{
+	std::unique_lock<std::shared_mutex> lock(mutex);
+	curves.erase(flightNumber);
+}
+
+// ==================== Pricing Rules ====================
+
+double PricingEngine::getLoadFactorMultiplier(double loadFactor) noexcept
+{
+	double multiplier = LOAD_FACTOR_TIERS[0].multiplier;
+	for (const PricingTier& tier : LOAD_FACTOR_TIERS)
+	{
+		if (loadFactor >= tier.threshold)
+			multiplier = tier.multiplier;
+	}
+	return multiplier;
+}
+
+double PricingEngine::getAdvancePurchaseMultiplier(double daysToDeparture) noexcept
+{
+	for (const PricingTier& tier : ADVANCE_PURCHASE_TIERS)
+	{
+		if (daysToDeparture >= tier.threshold)
+			return tier.multiplier;
+	}
+	return std::end(ADVANCE_PURCHASE_TIERS)[-1].multiplier;
+}
+
+// ==================== Helper Methods ====================
+
+bool PricingEngine::buildCurve(const shared_ptr<Flight>& flight, std::time_t now, PriceCurve& curve)
+{
+	shared_ptr<const AircraftConfig> config = AircraftManager::getInstance()->getAircraftConfig(flight->getAircraftType());
+	const vector<FareBucket>& buckets = flight->getFareBuckets();
+	if (!config || buckets.size() != config->cabinSeats.size())
+	{
+		return false;
+	}
+	
+	// Advance-purchase tier for now, and the instant the flight crosses into the next one
+	double advanceMultiplier = 1.0;
+	curve.validUntil = std::numeric_limits<std::time_t>::max();
+	std::time_t departure = Flight::parseDateTime(flight->getDepartureDateTime());
+	if (departure != -1)
+	{
+		double days = std::difftime(departure, now) / 86400.0;
+		advanceMultiplier = getAdvancePurchaseMultiplier(days);
+		for (const PricingTier& tier : ADVANCE_PURCHASE_TIERS)
+		{
+			if (days >= tier.threshold)
+			{
+				curve.validUntil = departure - static_cast<std::time_t>(tier.threshold * 86400);
+				break;
+			}
+		}
+	}
+	
+	curve.faresBySold.resize(buckets.size());
+	curve.sold.assign(buckets.size(), 0);
+	curve.currentFares.assign(buckets.size(), 0.0);
+	for (size_t i = 0; i < buckets.size(); ++i)
+	{
+		int seats = std::max(config->cabinSeats[i], 1);
+		vector<double>& fares = curve.faresBySold[i];
+		fares.reserve(seats + 1);
+		for (int sold = 0; sold <= seats; ++sold)
+		{
+			double fare = buckets[i].price * advanceMultiplier *
+			              getLoadFactorMultiplier(static_cast<double>(sold) / seats);
+			fares.push_back(std::round(fare * 100.0) / 100.0);
+		}
+		applyLoad(curve, i, buckets[i].sold);
+	}
+	
+	return true;
+}
+
+void PricingEngine::applyLoad(PriceCurve& curve, size_t cabinIndex, int sold)
+{
+	const vector<double>& fares = curve.faresBySold[cabinIndex];
+	curve.sold[cabinIndex] = sold;
+	curve.currentFares[cabinIndex] = fares[std::clamp(sold, 0, static_cast<int>(fares.size()) - 1)];
+	auto cheapest = std::min_element(curve.currentFares.begin(), curve.currentFares.end());
+	curve.leadInFare = *cheapest;
+	curve.leadInCabin = static_cast<int>(cheapest - curve.currentFares.begin());
+}
+
+double PricingEngine::fareAt(const PriceCurve& curve, int cabinIndex) noexcept
+{
+	if (cabinIndex < 0 || cabinIndex >= static_cast<int>(curve.currentFares.size()))
+	{
+		return curve.leadInFare;
+	}
+	return curve.currentFares[cabinIndex];
+}
@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include "SeatAllocator.hpp"
+
+static constexpr int AISLE_CROSSING_PENALTY = 100;
+static constexpr int POSITION_MISS_PENALTY = 50;
+static constexpr int ROW_SPLIT_PENALTY = 1000;
+static constexpr int ROW_OFFSET_PENALTY = 5;
+
+// ==================== Constructor ====================
+
+SeatAllocator::SeatAllocator(const SeatLayout& layout, int rows, const vector<int>& rowCabins)
+	: layout(layout), rows(rows)
+{
+	if (static_cast<int>(rowCabins.size()) != rows)
+	{
+		cabinRows.emplace_back(1, rows);
+		return;
+	}
+	
+	// Cabins are contiguous row ranges; a cabin index with no rows gets an empty range
+	for (int row = 1; row <= rows; ++row)
+	{
+		size_t cabinIndex = static_cast<size_t>(std::max(rowCabins[row - 1], 0));
+		if (cabinIndex >= cabinRows.size())
+		{
+			cabinRows.resize(cabinIndex + 1, {rows + 1, 0});
+		}
+		cabinRows[cabinIndex].first = std::min(cabinRows[cabinIndex].first, row);
+		cabinRows[cabinIndex].second = std::max(cabinRows[cabinIndex].second, row);
+	}
+}
+
+// ==================== Allocation ====================
+
+vector<int> SeatAllocator::allocate(const SeatBitset& occupied, const SeatPreferences& preferences) const
+{
+	vector<int> seats;
+	
+	if (preferences.partySize <= 0 || (!preferences.partial && preferences.partySize > layout.seatsPerRow * rows))
+	{
+		return seats;
+	}
+	
+	if (preferences.cabin >= 0)
+	{
+		if (preferences.cabin < static_cast<int>(cabinRows.size()))
+		{
+			const auto& [firstRow, lastRow] = cabinRows[preferences.cabin];
+			allocateInRows(occupied, preferences, firstRow, lastRow, seats);
+		}
+		return seats;
+	}
+	
+	for (const auto& [firstRow, lastRow] : cabinRows)
+	{
+		if (allocateInRows(occupied, preferences, firstRow, lastRow, seats))
+		{
+			return seats;
+		}
+	}
+	return seats;
+}
+
+bool SeatAllocator::allocateInRows(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+                                   vector<int>& seats) const
+{
+	if (findSameRow(occupied, preferences, firstRow, lastRow, seats))
+	{
+		return true;
+	}
+	
+	if (preferences.arrangement != GroupArrangement::SAME_ROW &&
+	    findAdjacentRows(occupied, preferences, firstRow, lastRow, seats))
+	{
+		return true;
+	}
+	
+	if (preferences.arrangement == GroupArrangement::ANYWHERE &&
+	    findAnywhere(occupied, preferences, firstRow, lastRow, seats))
+	{
+		return true;
+	}
+	
+	seats.clear();
+	return false;
+}
+
+bool SeatAllocator::findSameRow(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+                                vector<int>& seats) const
+{
+	int count = preferences.partySize;
+	if (count > layout.seatsPerRow)
+	{
+		return false;
+	}
+	
+	int bestScore = INT_MAX;
+	int bestRow = 0;
+	int bestOrdinal = 0;
+	
+	for (int row = firstRow; row <= lastRow; ++row)
+	{
+		for (int first = 0; first + count <= layout.seatsPerRow; ++first)
+		{
+			if (!isBlockFree(occupied, row, first, count))
+			{
+				continue;
+			}
+			
+			int score = scoreBlock(row, first, count, preferences.position);
+			if (score < bestScore)
+			{
+				bestScore = score;
+				bestRow = row;
+				bestOrdinal = first;
+			}
+		}
+	}
+	
+	if (bestScore == INT_MAX)
+	{
+		return false;
+	}
+	
+	seats.clear();
+	appendBlock(seats, bestRow, bestOrdinal, count);
+	return true;
+}
+
+bool SeatAllocator::findAdjacentRows(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+                                     vector<int>& seats) const
+{
+	// Front row takes the larger half
+	int frontCount = (preferences.partySize + 1) / 2;
+	int backCount = preferences.partySize / 2;
+	if (frontCount > layout.seatsPerRow)
+	{
+		return false;
+	}
+	
+	int bestScore = INT_MAX;
+	int bestRow = 0;
+	int bestFront = 0;
+	int bestBack = 0;
+	
+	for (int row = firstRow; row < lastRow; ++row)
+	{
+		for (int front = 0; front + frontCount <= layout.seatsPerRow; ++front)
+		{
+			if (!isBlockFree(occupied, row, front, frontCount))
+			{
+				continue;
+			}
+			
+			int frontScore = scoreBlock(row, front, frontCount, preferences.position);
+			
+			for (int back = 0; back + backCount <= layout.seatsPerRow; ++back)
+			{
+				if (!isBlockFree(occupied, row + 1, back, backCount))
+				{
+					continue;
+				}
+				
+				// Keep the two halves stacked above each other where possible
+				int score = ROW_SPLIT_PENALTY + frontScore + scoreBlock(row + 1, back, backCount, SeatPosition::ANY) +
+				            std::abs(front - back) * ROW_OFFSET_PENALTY;
+				if (score < bestScore)
+				{
+					bestScore = score;
+					bestRow = row;
+					bestFront = front;
+					bestBack = back;
+				}
+			}
+		}
+	}
+	
+	if (bestScore == INT_MAX)
+	{
+		return false;
+	}
+	
+	seats.clear();
+	appendBlock(seats, bestRow, bestFront, frontCount);
+	appendBlock(seats, bestRow + 1, bestBack, backCount);
+	return true;
+}
+
+bool SeatAllocator::findAnywhere(const SeatBitset& occupied, const SeatPreferences& preferences, int firstRow, int lastRow,
+                                 vector<int>& seats) const
+{
+	seats.clear();
+	int endSeat = lastRow * layout.seatsPerRow;
+	
+	// Preferred positions first, then whatever is left, front to back
+	for (int pass = 0; pass < 2 && static_cast<int>(seats.size()) < preferences.partySize; ++pass)
+	{
+		for (int seatIndex = (firstRow - 1) * layout.seatsPerRow; seatIndex < endSeat && static_cast<int>(seats.size()) < preferences.partySize; ++seatIndex)
+		{
+			if (occupied.test(seatIndex))
+			{
+				continue;
+			}
+			
+			int ordinal = seatIndex % layout.seatsPerRow;
+			bool preferred = preferences.position == SeatPosition::ANY ||
+			                 (preferences.position == SeatPosition::WINDOW && layout.isWindow(ordinal)) ||
+			                 (preferences.position == SeatPosition::AISLE && layout.isAisle(ordinal));
+			
+			if (preferred == (pass == 0))
+			{
+				seats.push_back(seatIndex);
+			}
+		}
+	}
+	
+	return static_cast<int>(seats.size()) == preferences.partySize || (preferences.partial && !seats.empty());
+}
+
+// ==================== Helper Methods ====================
+
+bool SeatAllocator::isBlockFree(const SeatBitset& occupied, int row, int firstOrdinal, int count) const
+{
+	int base = (row - 1) * layout.seatsPerRow;
+	for (int ordinal = firstOrdinal; ordinal < firstOrdinal + count; ++ordinal)
+	{
+		if (occupied.test(base + ordinal))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int SeatAllocator::scoreBlock(int row, int firstOrdinal, int count, SeatPosition position) const
+{
+	int score = aisleCrossings(firstOrdinal, count) * AISLE_CROSSING_PENALTY + row;
+	
+	if (position != SeatPosition::ANY)
+	{
+		bool satisfied = false;
+		for (int ordinal = firstOrdinal; ordinal < firstOrdinal + count; ++ordinal)
+		{
+			if ((position == SeatPosition::WINDOW && layout.isWindow(ordinal)) ||
+			    (position == SeatPosition::AISLE && layout.isAisle(ordinal)))
+			{
+				satisfied = true;
+				break;
+			}
+		}
+		
+		if (!satisfied)
+		{
+			score += POSITION_MISS_PENALTY;
+		}
+	}
+	
+	return score;
+}
+
+int SeatAllocator::aisleCrossings(int firstOrdinal, int count) const
+{
+	int crossings = 0;
+	for (int ordinal = firstOrdinal; ordinal < firstOrdinal + count - 1; ++ordinal)
+	{
+		if (layout.aisleAfter[ordinal])
+		{
+			++crossings;
+		}
+	}
+	return crossings;
+}
+
+void SeatAllocator::appendBlock(vector<int>& seats, int row, int firstOrdinal, int count) const
+{
+	int base = (row - 1) * layout.seatsPerRow;
+	for (int ordinal = firstOrdinal; ordinal < firstOrdinal + count; ++ordinal)
+	{
+		seats.push_back(base + ordinal);
+	}
+}
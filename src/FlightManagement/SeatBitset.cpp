@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include "SeatBitset.hpp"
+
+// ==================== Constructors ====================
+
+SeatBitset::SeatBitset() : seatCount(0) {}
+
+SeatBitset::SeatBitset(int seatCount) : seatCount(0)
+{
+	resize(seatCount);
+}
+
+// ==================== Capacity ====================
+
+int SeatBitset::size() const noexcept
+{
+	return seatCount;
+}
+
+void SeatBitset::resize(int seatCount)
+{
+	if (seatCount < 0)
+	{
+		seatCount = 0;
+	}
+
+	this->seatCount = seatCount;
+	words.resize((seatCount + 63) / 64, 0);
+
+	// Drop bits beyond the new size so count() stays exact
+	if (seatCount % 64 != 0)
+	{
+		words.back() &= (uint64_t(1) << (seatCount % 64)) - 1;
+	}
+}
+
+void SeatBitset::clear() noexcept
+{
+	for (uint64_t& word : words)
+	{
+		word = 0;
+	}
+}
+
+// ==================== Bit Operations ====================
+
+bool SeatBitset::test(int index) const noexcept
+{
+	if (index < 0 || index >= seatCount)
+	{
+		return false;
+	}
+
+	return (words[index / 64] >> (index % 64)) & 1;
+}
+
+bool SeatBitset::set(int index) noexcept
+{
+	if (index < 0 || index >= seatCount || test(index))
+	{
+		return false;
+	}
+
+	words[index / 64] |= uint64_t(1) << (index % 64);
+	return true;
+}
+
+bool SeatBitset::reset(int index) noexcept
+{
+	if (!test(index))
+	{
+		return false;
+	}
+
+	words[index / 64] &= ~(uint64_t(1) << (index % 64));
+	return true;
+}
+
+int SeatBitset::count() const noexcept
+{
+	int total = 0;
+	for (uint64_t word : words)
+	{
+		total += static_cast<int>(std::bitset<64>(word).count());
+	}
+	return total;
+}
+
+int SeatBitset::count(int first, int last) const noexcept
+{
+	first = std::max(first, 0);
+	last = std::min(last, seatCount);
+
+	// Whole words at a time, masked at both ends of the range
+	int total = 0;
+	for (int index = first; index < last;)
+	{
+		int offset = index % 64;
+		int bits = std::min(64 - offset, last - index);
+		uint64_t mask = bits == 64 ? ~uint64_t(0) : ((uint64_t(1) << bits) - 1) << offset;
+		total += static_cast<int>(std::bitset<64>(words[index / 64] & mask).count());
+		index += bits;
+	}
+	return total;
+}
+
+const vector<uint64_t>& SeatBitset::getWords() const noexcept
+{
+	return words;
+}
+
+// ==================== Serialization ====================
+
+string SeatBitset::toHex() const
+{
+	static const char digits[] = "0123456789abcdef";
+
+	string hex;
+	hex.reserve((seatCount + 3) / 4);
+
+	for (int nibble = 0; nibble * 4 < seatCount; ++nibble)
+	{
+		int value = static_cast<int>((words[nibble / 16] >> ((nibble % 16) * 4)) & 0xF);
+		hex.push_back(digits[value]);
+	}
+
+	size_t last = hex.find_last_not_of('0');
+	hex.erase(last == string::npos ? 0 : last + 1);
+	return hex;
+}
+
+SeatBitset SeatBitset::fromHex(const string& hex, int seatCount)
+{
+	SeatBitset bits(seatCount);
+
+	for (size_t nibble = 0; nibble < hex.length(); ++nibble)
+	{
+		char c = static_cast<char>(std::tolower(static_cast<unsigned char>(hex[nibble])));
+		int value = std::isdigit(static_cast<unsigned char>(c)) ? c - '0'
+		          : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : 0;
+
+		for (int bit = 0; bit < 4; ++bit)
+		{
+			if (value & (1 << bit))
+			{
+				bits.set(static_cast<int>(nibble) * 4 + bit);
+			}
+		}
+	}
+
+	return bits;
+}
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include "SeatInventory.hpp"
+#include "SeatMap.hpp"
+
+// ==================== Constructor ====================
+
+SeatInventory::SeatInventory(const string& aircraftType, const SeatLayout& layout, int rows, const SeatBitset& occupancy,
+                             const vector<int>& rowCabins)
+	: aircraftType(aircraftType), layout(&layout), rows(rows), seatCount(layout.seatsPerRow * rows),
+	  wordCount((seatCount + SEATS_PER_WORD - 1) / SEATS_PER_WORD),
+	  words(new std::atomic<uint64_t>[(seatCount + SEATS_PER_WORD - 1) / SEATS_PER_WORD]),
+	  reservedCount(0), heldCount(0),
+	  rowCabins(static_cast<int>(rowCabins.size()) == rows ? rowCabins : vector<int>(rows, 0)),
+	  cabinCount(1)
+{
+	for (int i = 0; i < wordCount; ++i)
+	{
+		words[i].store(0, std::memory_order_relaxed);
+	}
+	
+	for (int cabinIndex : this->rowCabins)
+	{
+		cabinCount = std::max(cabinCount, cabinIndex + 1);
+	}
+	cabinReserved.reset(new std::atomic<int>[cabinCount]);
+	for (int i = 0; i < cabinCount; ++i)
+	{
+		cabinReserved[i].store(0, std::memory_order_relaxed);
+	}
+	
+	// Seats beyond this aircraft's seat count are ignored
+	int reserved = 0;
+	for (int seatIndex = 0; seatIndex < seatCount; ++seatIndex)
+	{
+		if (occupancy.test(seatIndex))
+		{
+			uint64_t bits = static_cast<uint64_t>(SeatState::RESERVED) << ((seatIndex % SEATS_PER_WORD) * 2);
+			words[seatIndex / SEATS_PER_WORD].fetch_or(bits, std::memory_order_relaxed);
+			cabinReserved[this->rowCabins[seatIndex / layout.seatsPerRow]].fetch_add(1, std::memory_order_relaxed);
+			++reserved;
+		}
+	}
+	
+	reservedCount.store(reserved, std::memory_order_release);
+}
+
+// ==================== Getters ====================
+
+string SeatInventory::getAircraftType() const noexcept
+{
+	return aircraftType;
+}
+
+int SeatInventory::getSeatCount() const noexcept
+{
+	return seatCount;
+}
+
+int SeatInventory::getReservedCount() const noexcept
+{
+	return reservedCount.load(std::memory_order_acquire);
+}
+
+int SeatInventory::getHeldCount() const noexcept
+{
+	return heldCount.load(std::memory_order_acquire);
+}
+
+const SeatLayout& SeatInventory::getLayout() const noexcept
+{
+	return *layout;
+}
+
+int SeatInventory::getRows() const noexcept
+{
+	return rows;
+}
+
+int SeatInventory::getCabinCount() const noexcept
+{
+	return cabinCount;
+}
+
+int SeatInventory::getCabinReservedCount(int cabinIndex) const noexcept
+{
+	if (cabinIndex < 0 || cabinIndex >= cabinCount)
+	{
+		return 0;
+	}
+	return cabinReserved[cabinIndex].load(std::memory_order_acquire);
+}
+
+const vector<int>& SeatInventory::getRowCabins() const noexcept
+{
+	return rowCabins;
+}
+
+int SeatInventory::getSeatIndex(const string& seatNumber) const
+{
+	return SeatMap::seatToIndex(seatNumber, *layout, rows);
+}
+
+// ==================== Atomic Seat Operations ====================
+
+bool SeatInventory::transition(int seatIndex, SeatState from, SeatState to) noexcept
+{
+	if (seatIndex < 0 || seatIndex >= seatCount)
+	{
+		return false;
+	}
+	
+	std::atomic<uint64_t>& word = words[seatIndex / SEATS_PER_WORD];
+	int shift = (seatIndex % SEATS_PER_WORD) * 2;
+	uint64_t mask = uint64_t(3) << shift;
+	uint64_t fromBits = static_cast<uint64_t>(from) << shift;
+	uint64_t toBits = static_cast<uint64_t>(to) << shift;
+	uint64_t expected = word.load(std::memory_order_relaxed);
+	
+	// Retry only while other seats in the same word change underneath us
+	while ((expected & mask) == fromBits)
+	{
+		if (word.compare_exchange_weak(expected, (expected & ~mask) | toBits,
+		                               std::memory_order_acq_rel, std::memory_order_relaxed))
+		{
+			if (from == SeatState::RESERVED) reservedCount.fetch_sub(1, std::memory_order_acq_rel);
+			if (from == SeatState::HELD) heldCount.fetch_sub(1, std::memory_order_acq_rel);
+			if (to == SeatState::RESERVED) reservedCount.fetch_add(1, std::memory_order_acq_rel);
+			if (to == SeatState::HELD) heldCount.fetch_add(1, std::memory_order_acq_rel);
+			
+			// Fare bucket counters follow reservations only; holds are not sold
+			std::atomic<int>& cabin = cabinReserved[rowCabins[seatIndex / layout->seatsPerRow]];
+			if (from == SeatState::RESERVED) cabin.fetch_sub(1, std::memory_order_acq_rel);
+			if (to == SeatState::RESERVED) cabin.fetch_add(1, std::memory_order_acq_rel);
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+bool SeatInventory::tryReserve(int seatIndex) noexcept
+{
+	return transition(seatIndex, SeatState::FREE, SeatState::RESERVED);
+}
+
+bool SeatInventory::release(int seatIndex) noexcept
+{
+	return transition(seatIndex, SeatState::RESERVED, SeatState::FREE);
+}
+
+bool SeatInventory::isReserved(int seatIndex) const noexcept
+{
+	return getState(seatIndex) == SeatState::RESERVED;
+}
+
+// ==================== Seat Holds ====================
+
+bool SeatInventory::tryHold(int seatIndex) noexcept
+{
+	return transition(seatIndex, SeatState::FREE, SeatState::HELD);
+}
+
+bool SeatInventory::commitHold(int seatIndex) noexcept
+{
+	return transition(seatIndex, SeatState::HELD, SeatState::RESERVED);
+}
+
+bool SeatInventory::releaseHold(int seatIndex) noexcept
+{
+	return transition(seatIndex, SeatState::HELD, SeatState::FREE);
+}
+
+bool SeatInventory::isHeld(int seatIndex) const noexcept
+{
+	return getState(seatIndex) == SeatState::HELD;
+}
+
+SeatInventory::SeatState SeatInventory::getState(int seatIndex) const noexcept
+{
+	if (seatIndex < 0 || seatIndex >= seatCount)
+	{
+		return SeatState::FREE;
+	}
+	
+	uint64_t word = words[seatIndex / SEATS_PER_WORD].load(std::memory_order_acquire);
+	return static_cast<SeatState>((word >> ((seatIndex % SEATS_PER_WORD) * 2)) & 3);
+}
+
+// ==================== Persistence ====================
+
+SeatBitset SeatInventory::collect(SeatState state, bool invert) const
+{
+	SeatBitset bits(seatCount);
+	uint64_t target = static_cast<uint64_t>(state);
+	
+	for (int i = 0; i < wordCount; ++i)
+	{
+		uint64_t word = words[i].load(std::memory_order_acquire);
+		for (int slot = 0; word != 0; ++slot, word >>= 2)
+		{
+			if (((word & 3) == target) != invert)
+			{
+				bits.set(i * SEATS_PER_WORD + slot);
+			}
+		}
+	}
+	
+	return bits;
+}
+
+SeatBitset SeatInventory::snapshot() const
+{
+	return collect(SeatState::RESERVED);
+}
+
+SeatBitset SeatInventory::heldSnapshot() const
+{
+	return collect(SeatState::HELD);
+}
+
+SeatBitset SeatInventory::occupiedSnapshot() const
+{
+	return collect(SeatState::FREE, true);
+}
+
+std::mutex& SeatInventory::getPersistMutex() noexcept
+{
+	return persistMutex;
+}
@@ -0,0 +1,68 @@
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "SeatLayout.hpp"
+
+// ==================== Layout Lookup ====================
+
+const SeatLayout* SeatLayout::lookup(const string& layout)
+{
+	// Fast paths for the layouts we fly
+	if (layout == "3-3")   return &Layout3_3::value;
+	if (layout == "2-4-2") return &Layout2_4_2::value;
+	if (layout == "3-4-3") return &Layout3_4_3::value;
+	if (layout == "2-2")   return &Layout2_2::value;
+	
+	// Runtime fallback: parse once, then serve from cache
+	static std::unordered_map<string, std::unique_ptr<SeatLayout>> cache;
+	static std::mutex cacheMutex;
+	
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	
+	auto it = cache.find(layout);
+	if (it != cache.end())
+	{
+		return it->second.get();
+	}
+	
+	int sections[MAX_LAYOUT_SECTIONS] = {};
+	int count = 0;
+	int current = -1;
+	
+	for (char c : layout)
+	{
+		if (c >= '0' && c <= '9')
+		{
+			current = (current < 0 ? 0 : current * 10) + (c - '0');
+			if (current > MAX_SEATS_PER_ROW)
+			{
+				return nullptr;
+			}
+		}
+		else if (c == '-' && current >= 0 && count < MAX_LAYOUT_SECTIONS - 1)
+		{
+			sections[count++] = current;
+			current = -1;
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+	
+	if (current < 0)
+	{
+		return nullptr;
+	}
+	sections[count++] = current;
+	
+	auto parsed = std::make_unique<SeatLayout>(makeSeatLayout(sections, count));
+	if (parsed->sectionCount == 0)
+	{
+		return nullptr;
+	}
+	
+	const SeatLayout* result = parsed.get();
+	cache[layout] = std::move(parsed);
+	return result;
+}
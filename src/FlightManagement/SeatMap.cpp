@@ -1,5 +1,4 @@
 #include <iostream>
-#include <sstream>
 #include <algorithm>
 #include <cctype>
 #include "SeatMap.hpp"
@@ -8,7 +7,7 @@
 
 // ==================== Constructors ====================
 
-SeatMap::SeatMap(const string& seatLayout, int rows) : seatLayout(seatLayout), rows(rows)
+SeatMap::SeatMap(const string& seatLayout, int rows) : seatLayout(seatLayout), rows(rows), layout(nullptr)
 {
 	// Validate rows
 	if (rows <= 0)
@@ -27,30 +26,28 @@ SeatMap::SeatMap(const string& seatLayout, int rows) : seatLayout(seatLayout), r
 	{
 		throw SeatMapException("Invalid seat layout: Layout produces zero seats");
 	}
+	
+	layout = &resolveLayout(seatLayout);
+	reservedSeats.resize(layout->seatsPerRow * rows);
+	heldSeats.resize(layout->seatsPerRow * rows);
 }
 
 SeatMap::SeatMap(const string& seatLayout, int rows, const vector<string>& reservedSeats)
-	: seatLayout(seatLayout), rows(rows), reservedSeats(reservedSeats)
+	: SeatMap(seatLayout, rows)
 {
-	// Validate rows
-	if (rows <= 0)
-	{
-		throw SeatMapException("Invalid number of rows. Must be greater than 0");
-	}
-	
-	// Validate layout
-	if (!validateSeatLayout(seatLayout))
+	for (const string& seatNumber : reservedSeats)
 	{
-		throw SeatMapException("Invalid seat layout");
-	}
-	
-	// Validate that layout produces at least one seat
-	if (calculateSeatCount(seatLayout, rows) == 0)
-	{
-		throw SeatMapException("Invalid seat layout: Layout produces zero seats");
+		this->reservedSeats.set(seatToIndex(seatNumber, *layout, rows));
 	}
 }
 
+SeatMap::SeatMap(const string& seatLayout, int rows, const SeatBitset& reservedSeats)
+	: SeatMap(seatLayout, rows)
+{
+	this->reservedSeats = reservedSeats;
+	this->reservedSeats.resize(layout->seatsPerRow * rows);
+}
+
 // ==================== Static Validation Methods ====================
 
 bool SeatMap::validateSeatLayout(const string& layout)
@@ -84,46 +81,26 @@ bool SeatMap::validateSeatLayout(const string& layout)
 		return false;
 	}
 	
-	return true;
+	// Section widths must fit the seat letter range
+	return SeatLayout::lookup(layout) != nullptr;
 }
 
 // ==================== Helper Methods ====================
 
-vector<int> SeatMap::parseSeatLayout(const string& layout)
+const SeatLayout& SeatMap::resolveLayout(const string& seatLayout)
 {
-	vector<int> sections;
-	std::stringstream ss(layout);
-	string section;
-	
-	while (std::getline(ss, section, '-'))
+	const SeatLayout* layout = SeatLayout::lookup(seatLayout);
+	if (!layout)
 	{
-		sections.push_back(std::stoi(section));
+		throw SeatMapException("Invalid seat layout");
 	}
-	
-	return sections;
+	return *layout;
 }
 
 vector<char> SeatMap::generateSeatLetters(const string& layout)
 {
-	vector<int> sections = parseSeatLayout(layout);
-	vector<char> seatLetters;
-	char currentLetter = 'A';
-	
-	for (size_t i = 0; i < sections.size(); ++i)
-	{
-		for (int j = 0; j < sections[i]; ++j)
-		{
-			seatLetters.push_back(currentLetter++);
-		}
-		
-		// Skip a letter for aisle (except after last section)
-		if (i < sections.size() - 1)
-		{
-			currentLetter++;
-		}
-	}
-	
-	return seatLetters;
+	const SeatLayout& descriptor = resolveLayout(layout);
+	return vector<char>(descriptor.letters, descriptor.letters + descriptor.seatsPerRow);
 }
 
 // ==================== Static Seat Generation ====================
@@ -131,14 +108,14 @@ vector<char> SeatMap::generateSeatLetters(const string& layout)
 vector<string> SeatMap::generateSeatMap(const string& seatLayout, int rows)
 {
 	vector<string> seatMap;
-	vector<char> seatLetters = generateSeatLetters(seatLayout);
+	const SeatLayout& layout = resolveLayout(seatLayout);
 	
 	// Generate all seat numbers (e.g., 1A, 1B, 1C, ..., 30F)
 	for (int row = 1; row <= rows; ++row)
 	{
-		for (char letter : seatLetters)
+		for (int ordinal = 0; ordinal < layout.seatsPerRow; ++ordinal)
 		{
-			seatMap.push_back(std::to_string(row) + letter);
+			seatMap.push_back(std::to_string(row) + layout.letters[ordinal]);
 		}
 	}
 	
@@ -147,20 +124,12 @@ vector<string> SeatMap::generateSeatMap(const string& seatLayout, int rows)
 
 int SeatMap::calculateSeatCount(const string& seatLayout, int rows)
 {
-	return generateSeatMap(seatLayout, rows).size();
+	return getSeatsPerRow(seatLayout) * rows;
 }
 
 int SeatMap::getSeatsPerRow(const string& seatLayout)
 {
-	vector<int> sections = parseSeatLayout(seatLayout);
-	int seatsPerRow = 0;
-	
-	for (int section : sections)
-	{
-		seatsPerRow += section;
-	}
-	
-	return seatsPerRow;
+	return resolveLayout(seatLayout).seatsPerRow;
 }
 
 // ==================== Instance Methods ====================
@@ -172,67 +141,89 @@ vector<string> SeatMap::getAllSeats() const
 
 bool SeatMap::isValidSeat(const string& seatNumber) const
 {
-	if (seatNumber.empty())
+	return isValidSeatNumber(seatNumber, *layout, rows);
+}
+
+bool SeatMap::isValidSeatNumber(const string& seatNumber, const SeatLayout& layout, int rows)
+{
+	return seatToIndex(seatNumber, layout, rows) >= 0;
+}
+
+int SeatMap::seatToIndex(const string& seatNumber, const SeatLayout& layout, int rows)
+{
+	// Expected form: row digits followed by exactly one seat letter (e.g., 12C)
+	size_t length = seatNumber.length();
+	if (length < 2 || length > 10)
 	{
-		return false;
+		return -1;
 	}
 	
-	// Extract row number and seat letter
-	size_t letterPos = 0;
-	while (letterPos < seatNumber.length() && std::isdigit(seatNumber[letterPos]))
+	int row = 0;
+	for (size_t i = 0; i + 1 < length; ++i)
 	{
-		++letterPos;
+		char c = seatNumber[i];
+		if (c < '0' || c > '9')
+		{
+			return -1;
+		}
+		row = row * 10 + (c - '0');
+		if (row > rows)
+		{
+			return -1;
+		}
 	}
 	
-	if (letterPos == 0 || letterPos == seatNumber.length())
+	// Validate row number
+	if (row < 1)
 	{
-		return false; // No row number or no seat letter
+		return -1;
 	}
 	
-	string rowStr = seatNumber.substr(0, letterPos);
-	string seatLetter = seatNumber.substr(letterPos);
+	// Validate seat letter exists in this layout
+	int ordinal = layout.ordinalOf(seatNumber.back());
+	if (ordinal < 0)
+	{
+		return -1;
+	}
 	
-	// Validate row number
-	int row = std::stoi(rowStr);
-	if (row < 1 || row > rows)
+	return (row - 1) * layout.seatsPerRow + ordinal;
+}
+
+string SeatMap::indexToSeat(int seatIndex, const SeatLayout& layout)
+{
+	if (seatIndex < 0 || layout.seatsPerRow == 0)
 	{
-		return false;
+		return "";
 	}
 	
-	// Validate seat letter exists in this layout
-	vector<string> allSeats = getAllSeats();
-	return std::find(allSeats.begin(), allSeats.end(), seatNumber) != allSeats.end();
+	return std::to_string(seatIndex / layout.seatsPerRow + 1) + layout.letters[seatIndex % layout.seatsPerRow];
 }
 
 // ==================== Reservation Management ====================
 
 bool SeatMap::reserveSeat(const string& seatNumber)
 {
+	int seatIndex = seatToIndex(seatNumber, *layout, rows);
+	
 	// Validate seat exists
-	if (!isValidSeat(seatNumber))
+	if (seatIndex < 0)
 	{
 		throw SeatMapException("Seat" + seatNumber + " is an invalid seat number");
 	}
 	
-	// Check if seat is already reserved
-	if (!isSeatAvailable(seatNumber))
+	// Mark seat as reserved (fails if already reserved)
+	if (!reservedSeats.set(seatIndex))
 	{
 		throw SeatMapException("Seat" + seatNumber + " is already reserved");
 	}
 	
-	// Add seat to reserved list
-	reservedSeats.push_back(seatNumber);
 	return true;
 }
 
 bool SeatMap::releaseSeat(const string& seatNumber)
 {
-	// Find and remove the seat
-	auto it = std::find(reservedSeats.begin(), reservedSeats.end(), seatNumber);
-	
-	if (it != reservedSeats.end())
+	if (reservedSeats.reset(seatToIndex(seatNumber, *layout, rows)))
 	{
-		reservedSeats.erase(it);
 		return true;
 	}
 	
@@ -241,18 +232,37 @@ bool SeatMap::releaseSeat(const string& seatNumber)
 
 bool SeatMap::isSeatAvailable(const string& seatNumber) const
 {
-	// Check if seat is in reserved list
-	return std::find(reservedSeats.begin(), reservedSeats.end(), seatNumber) == reservedSeats.end();
+	int seatIndex = seatToIndex(seatNumber, *layout, rows);
+	return seatIndex >= 0 && !reservedSeats.test(seatIndex) && !heldSeats.test(seatIndex);
 }
 
 vector<string> SeatMap::getReservedSeats() const
+{
+	vector<string> seats;
+	for (int seatIndex = 0; seatIndex < reservedSeats.size(); ++seatIndex)
+	{
+		if (reservedSeats.test(seatIndex))
+		{
+			seats.push_back(indexToSeat(seatIndex, *layout));
+		}
+	}
+	return seats;
+}
+
+const SeatBitset& SeatMap::getReservedSeatBits() const noexcept
 {
 	return reservedSeats;
 }
 
 int SeatMap::getAvailableSeatsCount() const
 {
-	return getTotalSeatsCount() - reservedSeats.size();
+	return getTotalSeatsCount() - reservedSeats.count() - heldSeats.count();
+}
+
+void SeatMap::setHeldSeats(const SeatBitset& heldSeats)
+{
+	this->heldSeats = heldSeats;
+	this->heldSeats.resize(layout->seatsPerRow * rows);
 }
 
 int SeatMap::getTotalSeatsCount() const
@@ -268,9 +278,7 @@ void SeatMap::getSeatMapDisplayData(vector<string>& rowLabels,
 	rowLabels.clear();
 	gridData.clear();
 	
-	vector<string> allSeats = getAllSeats();
-	vector<int> sections = parseSeatLayout(seatLayout);
-	int seatsPerRow = getSeatsPerRow(seatLayout);
+	int seatsPerRow = layout->seatsPerRow;
 	
 	// Build row by row
 	for (int row = 1; row <= rows; ++row)
@@ -285,33 +293,16 @@ void SeatMap::getSeatMapDisplayData(vector<string>& rowLabels,
 		vector<string> gridRow;
 		int seatIndex = 0;
 		
-		for (size_t sectionIdx = 0; sectionIdx < sections.size(); ++sectionIdx)
+		for (int sectionIdx = 0; sectionIdx < layout->sectionCount; ++sectionIdx)
 		{
-			for (int seatInSection = 0; seatInSection < sections[sectionIdx]; ++seatInSection)
+			for (int seatInSection = 0; seatInSection < layout->sections[sectionIdx]; ++seatInSection)
 			{
-				int globalIndex = (row - 1) * seatsPerRow + seatIndex;
-				if (globalIndex < static_cast<int>(allSeats.size()))
-				{
-					string seatNum = allSeats[globalIndex];
-					
-					// Check if seat is reserved
-					bool isReserved = std::find(reservedSeats.begin(), reservedSeats.end(), seatNum) 
-									 != reservedSeats.end();
-					
-					if (isReserved)
-					{
-						gridRow.push_back("[X]");
-					}
-					else
-					{
-						gridRow.push_back("[" + seatNum + "]");
-					}
-				}
+				gridRow.push_back(renderSeatCell((row - 1) * seatsPerRow + seatIndex));
 				seatIndex++;
 			}
 			
 			// Add aisle spacing (except after last section)
-			if (sectionIdx < sections.size() - 1)
+			if (sectionIdx < layout->sectionCount - 1)
 			{
 				gridRow.push_back("  ");  // Aisle marker
 			}
@@ -321,6 +312,76 @@ void SeatMap::getSeatMapDisplayData(vector<string>& rowLabels,
 	}
 }
 
+void SeatMap::applyOccupancy(const SeatBitset& reservedSeats, const SeatBitset& heldSeats,
+                             vector<vector<string>>& gridData)
+{
+	int seatCount = layout->seatsPerRow * rows;
+	
+	SeatBitset newReserved = reservedSeats;
+	SeatBitset newHeld = heldSeats;
+	newReserved.resize(seatCount);
+	newHeld.resize(seatCount);
+	
+	const vector<uint64_t>& oldReservedWords = this->reservedSeats.getWords();
+	const vector<uint64_t>& oldHeldWords = this->heldSeats.getWords();
+	const vector<uint64_t>& newReservedWords = newReserved.getWords();
+	const vector<uint64_t>& newHeldWords = newHeld.getWords();
+	
+	// XOR whole words to find changed seats; unchanged words cost one compare
+	vector<int> changedSeats;
+	for (size_t w = 0; w < newReservedWords.size(); ++w)
+	{
+		uint64_t changed = (oldReservedWords[w] ^ newReservedWords[w]) | (oldHeldWords[w] ^ newHeldWords[w]);
+		for (int bit = 0; changed != 0; ++bit, changed >>= 1)
+		{
+			if (changed & 1)
+			{
+				changedSeats.push_back(static_cast<int>(w) * 64 + bit);
+			}
+		}
+	}
+	
+	this->reservedSeats = std::move(newReserved);
+	this->heldSeats = std::move(newHeld);
+	
+	for (int seatIndex : changedSeats)
+	{
+		int row = seatIndex / layout->seatsPerRow;
+		int ordinal = seatIndex % layout->seatsPerRow;
+		
+		// Grid rows carry one aisle marker cell after every section but the last
+		int column = ordinal;
+		for (int i = 0; i < ordinal; ++i)
+		{
+			if (layout->aisleAfter[i])
+			{
+				++column;
+			}
+		}
+		
+		if (row < static_cast<int>(gridData.size()) && column < static_cast<int>(gridData[row].size()))
+		{
+			gridData[row][column] = renderSeatCell(seatIndex);
+		}
+	}
+}
+
+string SeatMap::renderSeatCell(int seatIndex) const
+{
+	if (reservedSeats.test(seatIndex))
+	{
+		return "[X]";
+	}
+	
+	if (heldSeats.test(seatIndex))
+	{
+		return "[H]";
+	}
+	
+	int ordinal = seatIndex % layout->seatsPerRow;
+	return "[" + std::to_string(seatIndex / layout->seatsPerRow + 1) + layout->letters[ordinal] + "]";
+}
+
 vector<string> SeatMap::getSeatMapHeader(const string& flightNumber, const string& origin,
                                          const string& destination, const string& aircraftType) const
 {
@@ -333,7 +394,7 @@ vector<string> SeatMap::getSeatMapHeader(const string& flightNumber, const strin
 vector<string> SeatMap::getSeatMapLegend() const
 {
 	vector<string> legend;
-	legend.push_back("Legend: [Available] [X Reserved]");
+	legend.push_back("Legend: [Available] [X Reserved] [H Held]");
 	return legend;
 }
 
@@ -342,7 +403,11 @@ vector<string> SeatMap::getSeatMapFooter() const
 	vector<string> footer;
 	footer.push_back("Total Seats: " + std::to_string(getTotalSeatsCount()));
 	footer.push_back("Available: " + std::to_string(getAvailableSeatsCount()));
-	footer.push_back("Reserved: " + std::to_string(reservedSeats.size()));
+	footer.push_back("Reserved: " + std::to_string(reservedSeats.count()));
+	if (heldSeats.count() > 0)
+	{
+		footer.push_back("Held: " + std::to_string(heldSeats.count()));
+	}
 	return footer;
 }
 
@@ -6,12 +6,14 @@
 #include <map>
 #include <set>
 #include <ctime>
+#include <chrono>
 #include <filesystem>
 #include "ReportGenerator.hpp"
 #include "UsersManager.hpp"
 #include "FlightManager.hpp"
 #include "ReservationManager.hpp"
 #include "CrewManager.hpp"
+#include "CrewRoster.hpp"
 #include "AircraftManager.hpp"
 #include "Maintenance.hpp"
 
@@ -88,6 +90,13 @@ string ReportGenerator::getCurrentDateTime() const
 	return string(buffer);
 }
 
+string ReportGenerator::formatHours(double hours)
+{
+	std::ostringstream hoursStream;
+	hoursStream << std::fixed << std::setprecision(2) << hours;
+	return hoursStream.str();
+}
+
 void ReportGenerator::exportToFile(const string& reportName, const string& content)
 {
 	try
@@ -133,6 +142,8 @@ void ReportGenerator::generateReports()
 			"Crew Summary Report",
 			"Maintenance Summary Report",
 			"User Activity Report",
+			"Reservation Counter Consistency Check",
+			"Reservation History Replay",
 			"Back to Main Menu"
 		};
 		
@@ -140,7 +151,7 @@ void ReportGenerator::generateReports()
 		
 		try
 		{
-			int choice = ui->getChoice("Enter choice: ", 1, 7);
+			int choice = ui->getChoice("Enter choice: ", 1, 9);
 			
 			switch (choice)
 			{
@@ -163,6 +174,12 @@ void ReportGenerator::generateReports()
 					generateUsersReport();
 					break;
 				case 7:
+					verifyReservationCounters();
+					break;
+				case 8:
+					replayReservationHistory();
+					break;
+				case 9:
 					return;
 				default:
 					ui->printError("Invalid choice.");
@@ -209,7 +226,7 @@ void ReportGenerator::generateFlightPerformanceReport()
 			try
 			{
 				int totalSeats = flight->getTotalSeats();
-				int reservedSeats = flight->getReservedSeats().size();
+				int reservedSeats = flight->getReservedSeatCount();
 				if (totalSeats > 0)
 				{
 					double occupancy = (static_cast<double>(reservedSeats) / totalSeats) * 100.0;
@@ -373,7 +390,7 @@ void ReportGenerator::generateReservationStatisticsReport()
 			try
 			{
 				int totalSeats = flight->getTotalSeats();
-				int reservedSeats = flight->getReservedSeats().size();
+				int reservedSeats = flight->getReservedSeatCount();
 				
 				if (totalSeats > 0)
 				{
@@ -520,10 +537,22 @@ void ReportGenerator::generateCrewSummaryReport()
 		std::map<string, int> roleCounts;
 		std::map<string, int> statusCounts;
 		
+		// Monthly hours come from each member's ledger, so no flights are scanned
+		string currentMonth = Crew::getCurrentMonth();
+		double hoursThisMonth = 0.0;
+		vector<shared_ptr<Crew>> nearLimit;
+		
 		for (const auto& member : crew)
 		{
 			roleCounts[member->getRoleString()]++;
-			statusCounts[member->getStatusString()]++;
+			statusCounts[Crew::statusToString(CrewManager::getInstance()->getEffectiveStatus(member))]++;
+			
+			double memberHours = member->getMonthlyHours(currentMonth);
+			hoursThisMonth += memberHours;
+			if (memberHours >= CREW_FATIGUE_WARNING_HOURS)
+			{
+				nearLimit.push_back(member);
+			}
 		}
 		
 		vector<shared_ptr<Crew>> sortedCrew = crew;
@@ -536,7 +565,9 @@ void ReportGenerator::generateCrewSummaryReport()
 		addReportHeader(reportContent, "Crew Summary Report");
 		
 		vector<std::pair<string, string>> summaryStats = {
-			{"Total Crew Members", std::to_string(totalCrew)}
+			{"Total Crew Members", std::to_string(totalCrew)},
+			{"Flight Hours in " + currentMonth, formatHours(hoursThisMonth)},
+			{"Near Monthly Limit", std::to_string(nearLimit.size())}
 		};
 		
 		displayAndLogSummary(summaryStats, reportContent);
@@ -564,24 +595,43 @@ void ReportGenerator::generateCrewSummaryReport()
 		displayAndLogSection("Crew by Status", statusHeaders, statusRows, reportContent);
 		
 		// All Crew with Flight Hours
-		vector<string> crewHeaders = {"Crew ID", "Name", "Role", "Flight Hours"};
+		vector<string> crewHeaders = {"Crew ID", "Name", "Role", "Flight Hours", "This Month"};
 		vector<vector<string>> crewRows;
 		
 		for (const auto& member : sortedCrew)
 		{
-			std::ostringstream hoursStream;
-			hoursStream << std::fixed << std::setprecision(2) << member->getTotalFlightHours();
-			
 			crewRows.push_back({
 				member->getCrewId(),
 				member->getName(),
 				member->getRoleString(),
-				hoursStream.str()
+				formatHours(member->getTotalFlightHours()),
+				formatHours(member->getMonthlyHours(currentMonth))
 			});
 		}
 		
 		displayAndLogSection("All Crew Members by Flight Hours", crewHeaders, crewRows, reportContent);
 		
+		// Crew approaching the monthly duty limit
+		if (!nearLimit.empty())
+		{
+			vector<string> limitHeaders = {"Crew ID", "Name", "Role", "This Month", "Remaining"};
+			vector<vector<string>> limitRows;
+			
+			for (const auto& member : nearLimit)
+			{
+				double memberHours = member->getMonthlyHours(currentMonth);
+				limitRows.push_back({
+					member->getCrewId(),
+					member->getName(),
+					member->getRoleString(),
+					formatHours(memberHours),
+					formatHours(std::max(CREW_MAX_MONTHLY_HOURS - memberHours, 0.0))
+				});
+			}
+			
+			displayAndLogSection("Crew Near Monthly Limit", limitHeaders, limitRows, reportContent);
+		}
+		
 		bool exportReport = ui->getYesNo("\nExport report to file?");
 		if (exportReport)
 		{
@@ -807,5 +857,127 @@ void ReportGenerator::generateUsersReport()
 		ui->printError("Error generating report: " + string(e.what()));
 	}
 	
+	ui->pauseScreen();
+}
+
+void ReportGenerator::verifyReservationCounters()
+{
+	ui->clearScreen();
+	ui->printHeader("Reservation Counter Consistency Check");
+	
+	try
+	{
+		auto mismatches = ReservationManager::getInstance()->verifyActiveReservationCounts();
+		
+		std::ostringstream reportContent;
+		addReportHeader(reportContent, "Reservation Counter Consistency Check");
+		
+		vector<std::pair<string, string>> summaryStats = {
+			{"Flights with Mismatched Counters", std::to_string(mismatches.size())}
+		};
+		
+		displayAndLogSummary(summaryStats, reportContent);
+		
+		if (mismatches.empty())
+		{
+			ui->printSuccess("Active reservation counters match the stored reservations.");
+			ui->pauseScreen();
+			return;
+		}
+		
+		vector<string> headers = {"Flight", "Counter", "Actual"};
+		vector<vector<string>> rows;
+		
+		for (const auto& mismatch : mismatches)
+		{
+			rows.push_back({mismatch.flightNumber, std::to_string(mismatch.counted), std::to_string(mismatch.actual)});
+		}
+		
+		displayAndLogSection("Mismatched Counters", headers, rows, reportContent);
+		
+		if (ui->getYesNo("\nRebuild counters from stored reservations?"))
+		{
+			ReservationManager::getInstance()->rebuildIndexes();
+			ui->printSuccess("Counters rebuilt.");
+		}
+		
+		bool exportReport = ui->getYesNo("\nExport report to file?");
+		if (exportReport)
+		{
+			exportToFile("ReservationCounters", reportContent.str());
+		}
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError("Error generating report: " + string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+void ReportGenerator::replayReservationHistory()
+{
+	ui->clearScreen();
+	ui->printHeader("Reservation History Replay");
+	
+	try
+	{
+		auto start = std::chrono::steady_clock::now();
+		ReplayResult replay = ReservationManager::getInstance()->replayEventLog();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		
+		vector<string> divergent = ReservationManager::getInstance()->findDivergentReservations(replay.reservations);
+		
+		std::ostringstream reportContent;
+		addReportHeader(reportContent, "Reservation History Replay");
+		
+		std::ostringstream elapsed;
+		elapsed << std::fixed << std::setprecision(2) << seconds << " s";
+		
+		vector<std::pair<string, string>> summaryStats = {
+			{"Events Replayed", std::to_string(replay.eventsApplied)},
+			{"Malformed Events Skipped", std::to_string(replay.malformedEvents)},
+			{"Replay Threads", std::to_string(replay.threadsUsed)},
+			{"Replay Time", elapsed.str()},
+			{"Reservations Rebuilt", std::to_string(replay.reservations.size())},
+			{"Stored Reservations Differing", std::to_string(divergent.size())}
+		};
+		
+		displayAndLogSummary(summaryStats, reportContent);
+		
+		if (divergent.empty())
+		{
+			ui->printSuccess("Stored reservations match their event history.");
+			ui->pauseScreen();
+			return;
+		}
+		
+		vector<string> headers = {"Reservation ID"};
+		vector<vector<string>> rows;
+		
+		for (const auto& reservationId : divergent)
+		{
+			rows.push_back({reservationId});
+		}
+		
+		displayAndLogSection("Differing Reservations", headers, rows, reportContent);
+		
+		if (ui->getYesNo("\nRestore reservations from their event history?"))
+		{
+			ReservationManager::getInstance()->restoreReservations(replay.reservations);
+			ui->printSuccess("Reservations restored.");
+		}
+		
+		bool exportReport = ui->getYesNo("\nExport report to file?");
+		if (exportReport)
+		{
+			exportToFile("ReservationReplay", reportContent.str());
+		}
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError("Error generating report: " + string(e.what()));
+	}
+	
 	ui->pauseScreen();
 }
\ No newline at end of file
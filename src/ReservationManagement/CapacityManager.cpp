@@ -0,0 +1,337 @@
+#include <algorithm>
+#include <cmath>
+#include "CapacityManager.hpp"
+#include "ReservationManager.hpp"
+#include "FlightManager.hpp"
+#include "JobScheduler.hpp"
+
+// Static member initialization
+CapacityManager* CapacityManager::instance = nullptr;
+
+// ==================== No-Show Statistics ====================
+
+double NoShowStats::getRate() const noexcept
+{
+	return bookings > 0 ? static_cast<double>(noShows) / bookings : 0.0;
+}
+
+// ==================== Unseated Order ====================
+
+bool UnseatedOrder::operator()(const UnseatedKey& a, const UnseatedKey& b) const noexcept
+{
+	if (a.first != b.first)
+	{
+		return a.first < b.first;
+	}
+	// IDs share the "RES_" prefix, so the shorter number is the smaller one
+	if (a.second.size() != b.second.size())
+	{
+		return a.second.size() < b.second.size();
+	}
+	return a.second < b.second;
+}
+
+// ==================== Constructor & Singleton ====================
+
+CapacityManager::CapacityManager() : modelLoaded(false)
+{
+	db = std::make_unique<Database>("NoShowModel");
+	JobScheduler::getInstance()->scheduleRecurring("NoShowModelRefresh",
+		std::chrono::minutes(NO_SHOW_REFRESH_MINUTES), [this]() { refreshNoShowModel(); });
+}
+
+CapacityManager* CapacityManager::getInstance()
+{
+	if (instance == nullptr)
+	{
+		instance = new CapacityManager();
+	}
+	return instance;
+}
+
+// ==================== Booking Path ====================
+
+int CapacityManager::getAuthorizedCapacity(const string& flightNumber)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return getFlightCapacity(flightNumber).authorizedSeats;
+}
+
+double CapacityManager::getNoShowRate(const string& flightNumber)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return getRouteNoShowRate(getFlightCapacity(flightNumber).routeKey);
+}
+
+bool CapacityManager::tryAuthorizeOverbooking(const string& flightNumber)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	FlightCapacity& capacity = getFlightCapacity(flightNumber);
+	if (capacity.physicalSeats + capacity.unseatedBookings >= capacity.authorizedSeats)
+	{
+		return false;
+	}
+	
+	++capacity.unseatedBookings;
+	return true;
+}
+
+void CapacityManager::releaseOverbooking(const string& flightNumber)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	auto it = flightCapacities.find(flightNumber);
+	if (it != flightCapacities.end() && it->second.unseatedBookings > 0)
+	{
+		--it->second.unseatedBookings;
+	}
+}
+
+void CapacityManager::trackUnseated(const string& flightNumber, const UnseatedKey& key, bool unseated)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	// Flights not cached yet pick the reservation up when their capacity is first built
+	auto it = flightCapacities.find(flightNumber);
+	if (it == flightCapacities.end())
+	{
+		return;
+	}
+	
+	if (unseated)
+	{
+		it->second.unseatedQueue.insert(key);
+	}
+	else
+	{
+		it->second.unseatedQueue.erase(key);
+	}
+}
+
+bool CapacityManager::getFirstUnseated(const string& flightNumber, UnseatedKey& key)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	const std::set<UnseatedKey, UnseatedOrder>& queue = getFlightCapacity(flightNumber).unseatedQueue;
+	if (queue.empty())
+	{
+		return false;
+	}
+	
+	key = *queue.begin();
+	return true;
+}
+
+// ==================== Model Maintenance ====================
+
+void CapacityManager::recordDeparture(const shared_ptr<Flight>& flight)
+{
+	if (!flight || !hasDeparted(flight->getStatus()))
+	{
+		return;
+	}
+	
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!modelLoaded)
+	{
+		loadModelLocked();
+	}
+	foldFlightLocked(flight);	// No-op if already counted, e.g. by the first-run backfill
+}
+
+void CapacityManager::refreshNoShowModel()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!modelLoaded)
+	{
+		loadModelLocked();
+	}
+	refreshCapacitiesLocked();
+}
+
+void CapacityManager::loadModelLocked()
+{
+	modelLoaded = true;
+	
+	try
+	{
+		if (db->entryExists("model"))
+		{
+			json model = db->getEntry("model");
+			networkStats = statsFromJson(model.value("network", json::object()));
+			for (const auto& [routeKey, stats] : model.value("routes", json::object()).items())
+			{
+				routeStats[routeKey] = statsFromJson(stats);
+			}
+			for (const auto& [flightNumber, counted] : model.value("countedFlights", json::object()).items())
+			{
+				countedFlights.insert(flightNumber);
+			}
+			return;
+		}
+		
+		db->addEntry("model", json{{"network", statsToJson(networkStats)}, {"routes", json::object()},
+		                           {"countedFlights", json::object()}});
+	}
+	catch (const DatabaseException&)
+	{
+		throw ReservationException("Database error occurred while loading the no-show model.");
+	}
+	
+	// First run on an existing system: every departed flight is folded in once, then only events
+	for (const auto& flight : FlightManager::getInstance()->getAllFlights())
+	{
+		if (flight && hasDeparted(flight->getStatus()))
+		{
+			foldFlightLocked(flight);
+		}
+	}
+}
+
+void CapacityManager::foldFlightLocked(const shared_ptr<Flight>& flight)
+{
+	if (!countedFlights.insert(flight->getFlightNumber()).second)
+	{
+		return;
+	}
+	
+	NoShowStats flightStats;
+	for (const auto& res : ReservationManager::getInstance()->getReservationsByFlight(flight->getFlightNumber()))
+	{
+		if (res->getStatus() == ReservationStatus::CANCELED)
+		{
+			continue;
+		}
+		
+		flightStats.bookings += 1;
+		flightStats.noShows += res->isCheckedIn() ? 0 : 1;
+	}
+	
+	string routeKey = getRouteKey(flight);
+	NoShowStats& route = routeStats[routeKey];
+	route.bookings += flightStats.bookings;
+	route.noShows += flightStats.noShows;
+	networkStats.bookings += flightStats.bookings;
+	networkStats.noShows += flightStats.noShows;
+	
+	// One journal line: the flight is marked counted in the same record that adds its numbers
+	json update;
+	update["network"] = statsToJson(networkStats);
+	update["routes"][routeKey] = statsToJson(route);
+	update["countedFlights"][flight->getFlightNumber()] = true;
+	try
+	{
+		db->journalEntry("model", update);
+	}
+	catch (const DatabaseException& e)
+	{
+		// Kept in memory; the flight is counted again after a restart only if this record was lost
+		UserInterface::getInstance()->printError("Could not persist the no-show model: " + string(e.what()));
+	}
+}
+
+void CapacityManager::refreshCapacitiesLocked()
+{
+	// Re-derive cached capacities in place: unseatedBookings also counts authorizations whose
+	// reservations are not saved yet, so it must survive the refresh
+	for (auto it = flightCapacities.begin(); it != flightCapacities.end();)
+	{
+		shared_ptr<Flight> flight = FlightManager::getInstance()->getFlight(it->first);
+		if (!flight)
+		{
+			it = flightCapacities.erase(it);
+			continue;
+		}
+		
+		FlightCapacity& capacity = it->second;
+		capacity.routeKey = getRouteKey(flight);
+		capacity.physicalSeats = flight->getTotalSeats();
+		capacity.authorizedSeats = computeAuthorizedSeats(capacity.routeKey, capacity.physicalSeats);
+		++it;
+	}
+}
+
+// ==================== Helper Methods ====================
+
+CapacityManager::FlightCapacity& CapacityManager::getFlightCapacity(const string& flightNumber)
+{
+	auto it = flightCapacities.find(flightNumber);
+	if (it != flightCapacities.end())
+	{
+		return it->second;
+	}
+	
+	if (!modelLoaded)
+	{
+		loadModelLocked();
+	}
+	
+	shared_ptr<Flight> flight = FlightManager::getInstance()->getFlight(flightNumber);
+	if (!flight)
+	{
+		throw ReservationException("Flight not found.");
+	}
+	
+	FlightCapacity capacity;
+	capacity.routeKey = getRouteKey(flight);
+	capacity.physicalSeats = flight->getTotalSeats();
+	capacity.authorizedSeats = computeAuthorizedSeats(capacity.routeKey, capacity.physicalSeats);
+	capacity.unseatedBookings = 0;
+	
+	for (const auto& res : ReservationManager::getInstance()->getReservationsByFlight(flightNumber))
+	{
+		if (res->getStatus() == ReservationStatus::CONFIRMED && res->getSeatNumber() == UNASSIGNED_SEAT)
+		{
+			++capacity.unseatedBookings;
+			capacity.unseatedQueue.emplace(res->getBookingDate(), res->getReservationId());
+		}
+	}
+	
+	return flightCapacities[flightNumber] = capacity;
+}
+
+int CapacityManager::computeAuthorizedSeats(const string& routeKey, int physicalSeats) const
+{
+	double rate = getRouteNoShowRate(routeKey);
+	
+	// Expected show-ups at the authorized level should fill the cabin, within the overbooking cap
+	int expected = static_cast<int>(std::floor(physicalSeats / (1.0 - std::min(rate, 0.5))));
+	int cap = static_cast<int>(std::floor(physicalSeats * (1.0 + MAX_OVERBOOKING_RATE)));
+	return std::max(physicalSeats, std::min(expected, cap));
+}
+
+double CapacityManager::getRouteNoShowRate(const string& routeKey) const
+{
+	auto it = routeStats.find(routeKey);
+	if (it != routeStats.end() && it->second.bookings >= MIN_NO_SHOW_SAMPLE)
+	{
+		return it->second.getRate();
+	}
+	
+	// Thin routes borrow the network-wide rate; no history means no overbooking
+	return networkStats.bookings >= MIN_NO_SHOW_SAMPLE ? networkStats.getRate() : 0.0;
+}
+
+string CapacityManager::getRouteKey(const shared_ptr<Flight>& flight)
+{
+	return flight->getOrigin() + "-" + flight->getDestination();
+}
+
+bool CapacityManager::hasDeparted(const string& status)
+{
+	return status == "Departed" || status == "Arrived" || status == "Completed";
+}
+
+json CapacityManager::statsToJson(const NoShowStats& stats)
+{
+	return json{{"bookings", stats.bookings}, {"noShows", stats.noShows}};
+}
+
+NoShowStats CapacityManager::statsFromJson(const json& data)
+{
+	NoShowStats stats;
+	stats.bookings = data.value("bookings", 0);
+	stats.noShows = data.value("noShows", 0);
+	return stats;
+}
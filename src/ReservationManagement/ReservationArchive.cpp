@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include "ReservationArchive.hpp"
+
+namespace fs = std::filesystem;
+
+// ==================== Constructor ====================
+
+ReservationArchive::ReservationArchive(const string& entityName)
+	: directory("Databases/" + entityName), catalog(std::make_unique<Database>(entityName + "Catalog")), archivedCount(0)
+{
+	json allData = catalog->loadAll();
+	for (const auto& [month, entry] : allData.items())
+	{
+		indexMonth(month, entry);
+		archivedCount += entry.value("count", size_t(0));
+	}
+}
+
+// ==================== Archiving ====================
+
+void ReservationArchive::archive(const string& month, const json& reservations)
+{
+	if (reservations.empty())
+	{
+		return;
+	}
+	
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	json partition = loadPartition(month);
+	for (const auto& [reservationId, data] : reservations.items())
+	{
+		partition[reservationId] = data;
+	}
+	
+	// Catalog keys are rebuilt from the partition, so re-archiving a reservation is harmless
+	std::set<string> passengers, agents, flights;
+	for (const auto& [reservationId, data] : partition.items())
+	{
+		passengers.insert(data.value("passengerUsername", ""));
+		agents.insert(data.value("bookedByAgent", ""));
+		flights.insert(data.value("flightNumber", ""));
+	}
+	
+	json entry;
+	entry["count"] = partition.size();
+	entry["passengers"] = passengers;
+	entry["agents"] = agents;
+	entry["flights"] = flights;
+	
+	// Partition, then catalog; the caller deletes the hot rows last, so a crash only repeats the move
+	writePartition(month, partition);
+	
+	size_t previousCount = 0;
+	try
+	{
+		if (catalog->entryExists(month))
+		{
+			previousCount = catalog->getEntry(month).value("count", size_t(0));
+			catalog->updateEntry(month, entry);
+		}
+		else
+		{
+			catalog->addEntry(month, entry);
+		}
+	}
+	catch (const DatabaseException&)
+	{
+		throw DatabaseException("Error writing to reservation archive.");
+	}
+	
+	for (auto* months : {&monthsByPassenger, &monthsByAgent, &monthsByFlight})
+	{
+		for (auto it = months->begin(); it != months->end();)
+		{
+			it = it->second == month ? months->erase(it) : std::next(it);
+		}
+	}
+	indexMonth(month, entry);
+	archivedCount += partition.size() - previousCount;
+}
+
+// ==================== Lookups ====================
+
+vector<json> ReservationArchive::findByPassenger(const string& passengerUsername)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return find(monthsByPassenger, passengerUsername, "passengerUsername");
+}
+
+vector<json> ReservationArchive::findByAgent(const string& agentUsername)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return find(monthsByAgent, agentUsername, "bookedByAgent");
+}
+
+vector<json> ReservationArchive::findByFlight(const string& flightNumber)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return find(monthsByFlight, flightNumber, "flightNumber");
+}
+
+vector<json> ReservationArchive::loadAll()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	vector<json> results;
+	json allData = catalog->loadAll();
+	for (const auto& [month, entry] : allData.items())
+	{
+		for (const auto& [reservationId, data] : loadPartition(month).items())
+		{
+			results.push_back(data);
+		}
+	}
+	return results;
+}
+
+size_t ReservationArchive::getArchivedCount()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return archivedCount;
+}
+
+bool ReservationArchive::hasPartition(const string& partition)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return catalog->entryExists(partition);
+}
+
+string ReservationArchive::getPartitionKey(const string& departureDateTime)
+{
+	return departureDateTime.size() >= 7 ? departureDateTime.substr(0, 7) : "unknown";
+}
+
+// ==================== Helper Methods ====================
+
+const json& ReservationArchive::loadPartition(const string& month)
+{
+	for (auto it = cache.begin(); it != cache.end(); ++it)
+	{
+		if (it->first == month)
+		{
+			cache.splice(cache.begin(), cache, it);
+			return cache.front().second;
+		}
+	}
+	
+	json partition = json::object();
+	std::ifstream file(getPartitionPath(month), std::ios::binary);
+	if (file.is_open())
+	{
+		try
+		{
+			partition = json::from_cbor(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		}
+		catch (const json::exception&)
+		{
+			throw DatabaseException("Invalid data in reservation archive partition " + month + ".");
+		}
+	}
+	
+	cache.emplace_front(month, std::move(partition));
+	if (cache.size() > ARCHIVE_CACHED_PARTITIONS)
+	{
+		cache.pop_back();
+	}
+	return cache.front().second;
+}
+
+void ReservationArchive::writePartition(const string& month, const json& reservations)
+{
+	vector<uint8_t> bytes = json::to_cbor(reservations);
+	string path = getPartitionPath(month);
+	string tempPath = path + ".tmp";
+	
+	try
+	{
+		fs::create_directories(directory);
+		
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw DatabaseException("Error writing to reservation archive.");
+		}
+		file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		file.close();
+		if (!file)
+		{
+			throw DatabaseException("Error writing to reservation archive.");
+		}
+		
+		// Readers see either the old partition or the new one, never a partial file
+		fs::rename(tempPath, path);
+	}
+	catch (const fs::filesystem_error&)
+	{
+		throw DatabaseException("Error writing to reservation archive.");
+	}
+	
+	for (auto& [cachedMonth, partition] : cache)
+	{
+		if (cachedMonth == month)
+		{
+			partition = reservations;
+		}
+	}
+}
+
+void ReservationArchive::indexMonth(const string& month, const json& entry)
+{
+	for (const auto& passenger : entry.value("passengers", json::array()))
+		monthsByPassenger.emplace(passenger.get<string>(), month);
+	for (const auto& agent : entry.value("agents", json::array()))
+		monthsByAgent.emplace(agent.get<string>(), month);
+	for (const auto& flight : entry.value("flights", json::array()))
+		monthsByFlight.emplace(flight.get<string>(), month);
+}
+
+vector<json> ReservationArchive::find(const std::unordered_multimap<string, string>& months, const string& key,
+                                      const string& field)
+{
+	vector<string> matching;
+	auto range = months.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		matching.push_back(it->second);
+	}
+	
+	vector<json> results;
+	for (const string& month : matching)
+	{
+		for (const auto& [reservationId, data] : loadPartition(month).items())
+		{
+			if (data.value(field, "") == key)
+				results.push_back(data);
+		}
+	}
+	return results;
+}
+
+string ReservationArchive::getPartitionPath(const string& month) const
+{
+	return directory + "/" + month + ".cbor";
+}
@@ -0,0 +1,387 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include "ReservationEventLog.hpp"
+#include "Reservation.hpp"
+
+namespace fs = std::filesystem;
+
+// ==================== Constructor ====================
+
+ReservationEventLog::ReservationEventLog(const string& entityName)
+	: logPath("Databases/" + entityName + ".log"), snapshotDb(std::make_unique<Database>(entityName + "Snapshot"))
+{
+	recoverPosition();
+}
+
+// ==================== Recording ====================
+
+bool ReservationEventLog::describeChange(const json& before, const json& after, ReservationEvent& event)
+{
+	event.reservationId = after.value("reservationId", "");
+	event.flightNumber = after.value("flightNumber", "");
+	
+	if (before.is_null())
+	{
+		event.type = ReservationEventType::CREATED;
+		event.changes = after;
+		return true;
+	}
+	
+	event.changes = json::object();
+	for (const auto& [field, value] : after.items())
+	{
+		if (!before.contains(field) || before[field] != value)
+		{
+			event.changes[field] = value;
+		}
+	}
+	
+	if (event.changes.empty())
+	{
+		return false;
+	}
+	
+	// The most significant change names the event; `changes` still carries every field
+	if (event.changes.contains("status"))
+	{
+		auto status = static_cast<ReservationStatus>(event.changes["status"].get<int>());
+		if (status == ReservationStatus::CANCELED)
+			event.type = ReservationEventType::CANCELED;
+		else if (status == ReservationStatus::COMPLETED)
+			event.type = ReservationEventType::COMPLETED;
+		else
+			event.type = ReservationEventType::UPDATED;
+	}
+	else if (event.changes.contains("seatNumber"))
+	{
+		event.type = ReservationEventType::SEAT_CHANGED;
+	}
+	else if (event.changes.value("isCheckedIn", false))
+	{
+		event.type = ReservationEventType::CHECKED_IN;
+	}
+	else
+	{
+		event.type = ReservationEventType::UPDATED;
+	}
+	
+	return true;
+}
+
+bool ReservationEventLog::describeAbort(const json& before, const json& after, ReservationEvent& event)
+{
+	// An undone removal (archival) puts the whole row back
+	if (after.is_null())
+	{
+		event.type = ReservationEventType::ABORTED;
+		event.reservationId = before.value("reservationId", "");
+		event.flightNumber = before.value("flightNumber", "");
+		event.changes = before;
+		return true;
+	}
+	
+	if (!describeChange(before, after, event))
+	{
+		return false;
+	}
+	
+	event.type = ReservationEventType::ABORTED;
+	if (before.is_null())
+	{
+		event.changes = nullptr;
+		return true;
+	}
+	
+	// Each changed field goes back to its prior value; fields the change added are removed
+	for (auto& [field, value] : event.changes.items())
+	{
+		value = before.contains(field) ? before[field] : json(nullptr);
+	}
+	return true;
+}
+
+void ReservationEventLog::append(vector<ReservationEvent>& events)
+{
+	if (events.empty())
+	{
+		return;
+	}
+	
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	string lines;
+	uint64_t sequence = position.sequence;
+	for (auto& event : events)
+	{
+		event.sequence = ++sequence;
+		lines += eventToJson(event).dump();
+		lines += '\n';
+	}
+	
+	std::ofstream log(logPath, std::ios::app | std::ios::binary);
+	if (!log.is_open())
+	{
+		throw DatabaseException("Error writing to reservation event log.");
+	}
+	
+	log << lines;
+	log.flush();
+	if (!log)
+	{
+		throw DatabaseException("Error writing to reservation event log.");
+	}
+	
+	position.sequence = sequence;
+	position.offset += lines.size();
+}
+
+// ==================== Snapshots ====================
+
+EventLogPosition ReservationEventLog::getPosition()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return position;
+}
+
+bool ReservationEventLog::hasSnapshot()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return snapshotDb->entryExists("position");
+}
+
+bool ReservationEventLog::hasEventsSinceSnapshot()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return position.sequence > snapshotPosition.sequence;
+}
+
+void ReservationEventLog::writeSnapshot(const EventLogPosition& at, const json& reservations)
+{
+	json snapshot;
+	snapshot["position"] = {{"sequence", at.sequence}, {"offset", at.offset}};
+	snapshot["reservations"] = reservations;
+	
+	std::lock_guard<std::mutex> lock(mutex);
+	snapshotDb->saveAll(snapshot);
+	snapshotPosition = at;
+}
+
+// ==================== Replay ====================
+
+ReplayResult ReservationEventLog::replay()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	ReplayResult result;
+	json snapshot = snapshotDb->loadAll();
+	json base = snapshot.contains("reservations") ? snapshot["reservations"] : json::object();
+	
+	// Read the tail after the snapshot in one go and split it into lines
+	string tail;
+	{
+		std::ifstream log(logPath, std::ios::binary);
+		if (log.is_open() && position.offset > snapshotPosition.offset)
+		{
+			tail.resize(position.offset - snapshotPosition.offset);
+			log.seekg(static_cast<std::streamoff>(snapshotPosition.offset));
+			log.read(&tail[0], static_cast<std::streamsize>(tail.size()));
+			tail.resize(static_cast<size_t>(log.gcount()));
+		}
+	}
+	
+	vector<std::pair<size_t, size_t>> lines;	// (start, length)
+	for (size_t start = 0; start < tail.size();)
+	{
+		size_t end = tail.find('\n', start);
+		if (end == string::npos)
+			end = tail.size();
+		if (end > start)
+			lines.emplace_back(start, end - start);
+		start = end + 1;
+	}
+	
+	size_t threadCount = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(),
+	                                                          lines.size() / REPLAY_MIN_EVENTS_PER_THREAD));
+	result.threadsUsed = threadCount;
+	
+	auto partitionOf = [threadCount](const string& flightNumber) {
+		return std::hash<string>{}(flightNumber) % threadCount;
+	};
+	
+	// Phase 1: each thread parses a contiguous slice of lines and buckets the events by flight
+	// partition; slices are in log order, so a partition's buckets concatenate in sequence order
+	vector<vector<vector<ReservationEvent>>> parsed(threadCount, vector<vector<ReservationEvent>>(threadCount));
+	vector<size_t> malformed(threadCount, 0);
+	{
+		vector<std::thread> workers;
+		for (size_t t = 0; t < threadCount; ++t)
+		{
+			workers.emplace_back([&, t]() {
+				size_t first = lines.size() * t / threadCount;
+				size_t last = lines.size() * (t + 1) / threadCount;
+				for (size_t i = first; i < last; ++i)
+				{
+					ReservationEvent event;
+					if (eventFromJson(tail.data() + lines[i].first, lines[i].second, event))
+						parsed[t][partitionOf(event.flightNumber)].push_back(std::move(event));
+					else
+						++malformed[t];
+				}
+			});
+		}
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+	}
+	
+	// Phase 2: one thread per partition applies its flights' events over the snapshot state
+	vector<vector<std::pair<string, const json*>>> seeds(threadCount);
+	for (const auto& [reservationId, data] : base.items())
+	{
+		seeds[partitionOf(data.value("flightNumber", ""))].emplace_back(reservationId, &data);
+	}
+	
+	vector<std::unordered_map<string, json>> states(threadCount);
+	vector<size_t> applied(threadCount, 0);
+	{
+		vector<std::thread> workers;
+		for (size_t p = 0; p < threadCount; ++p)
+		{
+			workers.emplace_back([&, p]() {
+				auto& state = states[p];
+				for (const auto& [reservationId, data] : seeds[p])
+				{
+					state[reservationId] = *data;
+				}
+				
+				for (size_t t = 0; t < threadCount; ++t)
+				{
+					for (auto& event : parsed[t][p])
+					{
+						if (event.type == ReservationEventType::CREATED)
+							state[event.reservationId] = std::move(event.changes);
+						else if (event.type == ReservationEventType::ARCHIVED ||
+						         (event.type == ReservationEventType::ABORTED && event.changes.is_null()))
+							state.erase(event.reservationId);
+						else
+							state[event.reservationId].merge_patch(event.changes);
+						++applied[p];
+					}
+				}
+			});
+		}
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+	}
+	
+	result.reservations = json::object();
+	for (size_t p = 0; p < threadCount; ++p)
+	{
+		for (auto& [reservationId, data] : states[p])
+		{
+			result.reservations[reservationId] = std::move(data);
+		}
+		result.eventsApplied += applied[p];
+		result.malformedEvents += malformed[p];
+	}
+	
+	return result;
+}
+
+// ==================== Helper Methods ====================
+
+void ReservationEventLog::recoverPosition()
+{
+	if (snapshotDb->entryExists("position"))
+	{
+		json at = snapshotDb->getEntry("position");
+		snapshotPosition.sequence = at.value("sequence", uint64_t(0));
+		snapshotPosition.offset = at.value("offset", uint64_t(0));
+	}
+	
+	uint64_t fileSize = fs::exists(logPath) ? static_cast<uint64_t>(fs::file_size(logPath)) : 0;
+	if (fileSize < snapshotPosition.offset)
+	{
+		// The log was replaced behind the snapshot's back; its events all come after the snapshot
+		snapshotPosition.offset = 0;
+		snapshotDb->updateEntry("position", {{"offset", 0}});
+	}
+	
+	// Count the events after the snapshot; only this tail is read, never the whole history
+	position = snapshotPosition;
+	std::ifstream log(logPath, std::ios::binary);
+	if (!log.is_open())
+	{
+		return;
+	}
+	
+	log.seekg(static_cast<std::streamoff>(snapshotPosition.offset));
+	string line;
+	uint64_t offset = snapshotPosition.offset;
+	while (std::getline(log, line))
+	{
+		if (log.eof())
+		{
+			break;	// No newline: a torn final record from an interrupted write
+		}
+		
+		offset += line.size() + 1;
+		if (!line.empty())
+		{
+			++position.sequence;
+		}
+		position.offset = offset;
+	}
+	
+	log.close();
+	
+	// Drop a torn tail so the next append starts on a fresh line
+	if (position.offset < fileSize)
+	{
+		fs::resize_file(logPath, position.offset);
+	}
+}
+
+json ReservationEventLog::eventToJson(const ReservationEvent& event)
+{
+	return json{
+		{"sequence", event.sequence},
+		{"type", static_cast<int>(event.type)},
+		{"reservationId", event.reservationId},
+		{"flightNumber", event.flightNumber},
+		{"recordedAt", event.recordedAt},
+		{"changes", event.changes}
+	};
+}
+
+bool ReservationEventLog::eventFromJson(const char* line, size_t length, ReservationEvent& event)
+{
+	json data = json::parse(line, line + length, nullptr, false);
+	if (data.is_discarded() || !data.is_object() || !data.contains("reservationId") || !data.contains("changes"))
+	{
+		return false;
+	}
+	
+	try
+	{
+		event.sequence = data.value("sequence", uint64_t(0));
+		event.type = static_cast<ReservationEventType>(data.value("type", 0));
+		event.reservationId = data["reservationId"].get<string>();
+		event.flightNumber = data.value("flightNumber", "");
+		event.recordedAt = data.value("recordedAt", "");
+		event.changes = std::move(data["changes"]);
+	}
+	catch (const json::exception&)
+	{
+		return false;
+	}
+	
+	return true;
+}
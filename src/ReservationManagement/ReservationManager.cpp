@@ -1,18 +1,47 @@
 #include "ReservationManager.hpp"
 #include "FlightManager.hpp"
-#include "AircraftManager.hpp"
+#include "PricingEngine.hpp"
+#include "CapacityManager.hpp"
+#include "WaitlistManager.hpp"
 #include "UsersManager.hpp"
-#include "SeatMap.hpp"
+#include "JobScheduler.hpp"
 #include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
+#include <map>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
 
 ReservationManager* ReservationManager::instance = nullptr;
 
-ReservationManager::ReservationManager()
+ReservationManager::ReservationManager() : indexesBuilt(false)
 {
 	db = std::make_unique<Database>("Reservations"); 
 	ui = UserInterface::getInstance();
+	idempotencyKeys = std::make_unique<IdempotencyStore>("IdempotencyKeys", std::chrono::hours(IDEMPOTENCY_KEY_TTL_HOURS),
+	                                                     IDEMPOTENCY_KEY_CAPACITY);
+	eventLog = std::make_unique<ReservationEventLog>("ReservationEvents");
+	
+	// Reservations that predate the log enter its history through a baseline snapshot
+	if (!eventLog->hasSnapshot())
+	{
+		snapshotReservations();
+	}
+	
+	archive = std::make_unique<ReservationArchive>("ReservationArchive");
+	sequenceDb = std::make_unique<Database>("ReservationSequence");
+	seedReservationSequence();
+	
+	JobScheduler::getInstance()->scheduleRecurring("ReservationArchival",
+		std::chrono::hours(ARCHIVE_INTERVAL_HOURS), [this]() { archiveCompletedFlights(); });
+	JobScheduler::getInstance()->scheduleRecurring("ReservationSnapshot",
+		std::chrono::minutes(RESERVATION_SNAPSHOT_MINUTES), [this]() {
+			if (eventLog->hasEventsSinceSnapshot())
+				snapshotReservations();
+		});
 }
 
 ReservationManager* ReservationManager::getInstance()
@@ -35,6 +64,19 @@ void ReservationManager::createReservation(const string& agentUsername)
 	
 	try
 	{
+		// A retried request with the same reference returns the original booking
+		string reference = ui->getString("Request reference (optional, reuse it when retrying): ");
+		string scopedKey = reference.empty() ? "" : scopeIdempotencyKey(agentUsername, reference);
+		json previous;
+		if (!scopedKey.empty() && idempotencyKeys->lookup(scopedKey, previous))
+		{
+			BookingResult result = bookingResultFromJson(previous);
+			ui->printWarning("This request was already processed.");
+			ui->println("ID: " + result.reservationId + " (Seat " + result.seatNumber + ")");
+			ui->pauseScreen();
+			return;
+		}
+		
 		string passenger = ui->getString("Passenger username: ");
 		if (!UsersManager::getInstance()->userExists(passenger))
 			throw ReservationException("Passenger not found in system.");
@@ -45,42 +87,202 @@ void ReservationManager::createReservation(const string& agentUsername)
 		
 		auto flightObj = FlightManager::getInstance()->getFlight(flight);
 		
-		string seat = "";
-		while (true)
+		// A full cabin can still sell within the flight's authorized (overbooked) capacity
+		bool overbooked = false;
+		if (FlightManager::getInstance()->getAvailableSeatCount(flight) == 0)
 		{
-			if (ui->getYesNo("View seat map?"))
+			if (!CapacityManager::getInstance()->tryAuthorizeOverbooking(flight))
 			{
-				auto aircraft = AircraftManager::getInstance()->getAircraft(flightObj->getAircraftType());
-				SeatMap seatMap(aircraft->getSeatLayout(), aircraft->getRows(), flightObj->getReservedSeats());
-				
-				vector<string> rowLabels;
-				vector<vector<string>> gridData;
-				seatMap.getSeatMapDisplayData(rowLabels, gridData);
-				
-				GridDisplayConfig config;
-				config.title = "Seat Map";
-				config.headerLines = seatMap.getSeatMapHeader(flight, flightObj->getOrigin(),
-					flightObj->getDestination(), flightObj->getAircraftType());
-				config.legend = seatMap.getSeatMapLegend();
+				offerWaitlist(passenger, flight, agentUsername);
+				ui->pauseScreen();
+				return;
+			}
+			
+			overbooked = true;
+			ui->printWarning("All seats are taken. Booking within the overbooking allowance; "
+			                 "a seat will be assigned at check-in.");
+		}
+		
+		// A failure before the reservation is saved gives back the overbooking authorization or the seat
+		string seat = UNASSIGNED_SEAT;
+		uint64_t holdId = 0;
+		bool seatCommitted = false;
+		string resId;
+		double cost = 0.0;
+		try
+		{
+			while (!overbooked)
+			{
+				if (ui->getYesNo("View seat map?"))
+				{
+					FlightManager::getInstance()->displaySeatMap(flight);
+				}
 				
-				ui->displayGrid(rowLabels, gridData, config);
+				// Hold the seat while the agent confirms; it is released automatically if abandoned
+				seat = ui->getString("Seat number: ");
+				holdId = FlightManager::getInstance()->holdSeatForFlight(flight, seat);
+				if (holdId != 0)
+				{
+					ui->println("Seat " + seat + " is held for " + std::to_string(SEAT_HOLD_MINUTES) + " minutes.");
+					break;
+				}
+				ui->printError("Seat not available.");
+			}
+			
+			cost = PricingEngine::getInstance()->quoteSeat(flightObj, seat);
+			
+			ui->println("\n=== Summary ===");
+			ui->println("Passenger: " + passenger);
+			ui->println("Flight: " + flight);
+			ui->println("Seat: " + seat);
+			ui->println("Cost: " + ui->formatCurrency(cost));
+			
+			if (!ui->getYesNo("\nConfirm?"))
+			{
+				if (overbooked)
+					CapacityManager::getInstance()->releaseOverbooking(flight);
+				else
+					FlightManager::getInstance()->releaseSeatHold(holdId);
+				ui->printWarning("Canceled.");
+				ui->pauseScreen();
+				return;
 			}
 			
-			seat = ui->getString("Seat number: ");
-			if (flightObj->isSeatAvailable(seat)) break;
-			ui->printError("Seat not available.");
+			ui->println("\nProcessing payment...");
+			ui->println("Payment successful!");
+			
+			if (!overbooked && !FlightManager::getInstance()->commitSeatHold(holdId))
+				throw ReservationException("Failed to reserve or release seat. Please try again.");
+			seatCommitted = !overbooked;
+			
+			resId = "RES_" + std::to_string(getNextReservationNumber());
+			auto res = shared_ptr<Reservation>(new Reservation(
+				resId, passenger, flight, seat, ReservationStatus::CONFIRMED,
+				getCurrentDateTime(), cost, agentUsername, false, ""));
+			
+			saveReservationToDatabase(res);
+		}
+		catch (...)
+		{
+			if (overbooked)
+				CapacityManager::getInstance()->releaseOverbooking(flight);
+			else if (seatCommitted)
+				FlightManager::getInstance()->releaseSeatsForFlight(flight, {seat});
+			else if (holdId != 0)
+				FlightManager::getInstance()->releaseSeatHold(holdId);
+			throw;
+		}
+		
+		// The booking stands either way; failing here would invite a retry that books twice
+		if (!scopedKey.empty())
+		{
+			try
+			{
+				idempotencyKeys->record(scopedKey, bookingResultToJson(BookingResult{true, resId, seat, cost, ""}));
+			}
+			catch (const std::exception& e)
+			{
+				ui->printWarning("Could not record the request reference: " + string(e.what()));
+			}
+		}
+		
+		ui->printSuccess("Reservation created!");
+		ui->println("ID: " + resId);
+	}
+	catch (const std::exception& e)
+	{ 
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+void ReservationManager::createGroupReservation(const string& agentUsername)
+{
+	ui->clearScreen();
+	ui->printHeader("Create Group Reservation");
+	
+	try
+	{
+		int partySize = ui->getInt("Party size: ");
+		if (partySize < 2)
+			throw ReservationException("A group reservation needs at least 2 passengers.");
+		
+		vector<string> passengers;
+		for (int i = 1; i <= partySize; ++i)
+		{
+			string passenger = ui->getString("Passenger " + std::to_string(i) + " username: ");
+			if (!UsersManager::getInstance()->userExists(passenger))
+				throw ReservationException("Passenger not found in system.");
+			passengers.push_back(passenger);
+		}
+		
+		string flight = ui->getString("Flight number: ");
+		if (!FlightManager::getInstance()->flightExists(flight))
+			throw ReservationException("Flight not found.");
+		
+		auto flightObj = FlightManager::getInstance()->getFlight(flight);
+		
+		SeatPreferences preferences;
+		preferences.partySize = partySize;
+		
+		ui->displayMenu("Seat Position", {"No preference", "Window", "Aisle"});
+		preferences.position = static_cast<SeatPosition>(ui->getChoice("Enter choice: ", 1, 3) - 1);
+		
+		ui->displayMenu("Seating Arrangement", {"Same row only", "Same or adjacent rows", "Anywhere in the cabin"});
+		preferences.arrangement = static_cast<GroupArrangement>(ui->getChoice("Enter choice: ", 1, 3) - 1);
+		
+		// The whole party sits in one cabin and pays its fares
+		const vector<FareBucket>& buckets = flightObj->getFareBuckets();
+		if (buckets.size() > 1)
+		{
+			vector<string> cabinNames;
+			for (const auto& bucket : buckets)
+			{
+				cabinNames.push_back(bucket.cabin);
+			}
+			ui->displayMenu("Cabin", cabinNames);
+			preferences.cabin = ui->getChoice("Enter choice: ", 1, static_cast<int>(buckets.size())) - 1;
+		}
+		else if (buckets.size() == 1)
+		{
+			preferences.cabin = 0;
+		}
+		
+		// Another booking can take a seat between allocation and hold; retry with fresh occupancy
+		vector<string> seats;
+		vector<uint64_t> holdIds;
+		for (int attempt = 0; attempt < 3 && holdIds.empty(); ++attempt)
+		{
+			seats = FlightManager::getInstance()->findGroupSeats(flight, preferences);
+			if (seats.empty())
+				throw ReservationException("No seats match the requested arrangement.");
+			holdIds = FlightManager::getInstance()->holdSeatsForFlight(flight, seats);
 		}
 		
-		double cost = flightObj->getPrice();
+		if (holdIds.empty())
+			throw ReservationException("Seats were taken during allocation. Please try again.");
+		
+		// Priced in party order, each seat at the load left by the ones before it
+		vector<double> costs = PricingEngine::getInstance()->quoteSeats(flightObj, seats);
+		double totalCost = 0.0;
+		for (double cost : costs)
+		{
+			totalCost += cost;
+		}
 		
 		ui->println("\n=== Summary ===");
-		ui->println("Passenger: " + passenger);
 		ui->println("Flight: " + flight);
-		ui->println("Seat: " + seat);
-		ui->println("Cost: " + ui->formatCurrency(cost));
+		for (int i = 0; i < partySize; ++i)
+		{
+			ui->println(passengers[i] + ": Seat " + seats[i] + " (" + ui->formatCurrency(costs[i]) + ")");
+		}
+		ui->println("Total Cost: " + ui->formatCurrency(totalCost));
+		ui->println("Seats are held for " + std::to_string(SEAT_HOLD_MINUTES) + " minutes.");
 		
 		if (!ui->getYesNo("\nConfirm?"))
 		{
+			FlightManager::getInstance()->releaseSeatHolds(holdIds);
 			ui->printWarning("Canceled.");
 			ui->pauseScreen();
 			return;
@@ -89,18 +291,35 @@ void ReservationManager::createReservation(const string& agentUsername)
 		ui->println("\nProcessing payment...");
 		ui->println("Payment successful!");
 		
-		if (!FlightManager::getInstance()->reserveSeatForFlight(flight, seat))
+		if (!FlightManager::getInstance()->commitSeatHolds(holdIds))
 			throw ReservationException("Failed to reserve or release seat. Please try again.");
 		
-		string resId = "RES_" + std::to_string(db->getEntryCount() + 1);
-		auto res = shared_ptr<Reservation>(new Reservation(
-			resId, passenger, flight, seat, ReservationStatus::CONFIRMED,
-			getCurrentDateTime(), cost, agentUsername, false, ""));
-		
-		saveReservationToDatabase(res);
+		vector<shared_ptr<Reservation>> reservations;
+		try
+		{
+			int nextNumber = getNextReservationNumber(partySize);
+			for (int i = 0; i < partySize; ++i)
+			{
+				string resId = "RES_" + std::to_string(nextNumber + i);
+				reservations.push_back(shared_ptr<Reservation>(new Reservation(
+					resId, passengers[i], flight, seats[i], ReservationStatus::CONFIRMED,
+					getCurrentDateTime(), costs[i], agentUsername, false, "")));
+			}
+			
+			saveReservationsToDatabase(reservations);
+		}
+		catch (...)
+		{
+			// Committed seats would otherwise stay reserved with no reservation to release them
+			FlightManager::getInstance()->releaseSeatsForFlight(flight, seats);
+			throw;
+		}
+		for (int i = 0; i < partySize; ++i)
+		{
+			ui->println("ID: " + reservations[i]->getReservationId() + " (" + passengers[i] + ", Seat " + seats[i] + ")");
+		}
 		
-		ui->printSuccess("Reservation created!");
-		ui->println("ID: " + resId);
+		ui->printSuccess("Group reservation created!");
 	}
 	catch (const std::exception& e)
 	{ 
@@ -110,88 +329,68 @@ void ReservationManager::createReservation(const string& agentUsername)
 	ui->pauseScreen();
 }
 
-void ReservationManager::modifyReservation(const string& agentUsername)
-{
-	ui->clearScreen();
-	ui->printHeader("Modify Reservation");
-	updateOrCancel(true);
-}
-
-void ReservationManager::cancelReservation(const string& agentUsername)
+void ReservationManager::importReservations(const string& agentUsername)
 {
 	ui->clearScreen();
-	ui->printHeader("Cancel Reservation");
-	updateOrCancel(false);
-}
-
-void ReservationManager::updateOrCancel(bool isModify)
-{
+	ui->printHeader("Import Reservations");
+	
 	try
 	{
-		auto res = loadReservationFromDatabase(ui->getString("Reservation ID: "));
-		if (!res) throw ReservationException("Reservation not found.");
-		if (res->getStatus() != ReservationStatus::CONFIRMED)
-			throw ReservationException("Invalid status transition for this reservation.");
+		ui->println("One booking per line: passenger,flight[,seat[,reference[,cabin]]]. Leave the seat empty to have one assigned.");
+		string path = ui->getString("Booking file path: ");
 		
-		if (isModify)
+		std::ifstream file(path);
+		if (!file.is_open())
+			throw ReservationException("Could not open " + path + ".");
+		
+		auto trim = [](string& text)
 		{
-			ui->println("\nCurrent Seat: " + res->getSeatNumber());
-			
-			auto flight = FlightManager::getInstance()->getFlight(res->getFlightNumber());
-			string newSeat = "";
-			while (true)
-			{
-				newSeat = ui->getString("New seat number: ");
-				if (flight->isSeatAvailable(newSeat)) break;
-				ui->printError("Seat not available.");
-			}
-			
-			if (newSeat == res->getSeatNumber())
-			{
-				ui->printWarning("Same seat selected.");
-				ui->pauseScreen();
-				return;
-			}
-			
-			if (!ui->getYesNo("Change to " + newSeat + "?"))
-			{
-				ui->printWarning("Canceled.");
-				ui->pauseScreen();
-				return;
-			}
+			text.erase(0, text.find_first_not_of(" \t\r"));
+			text.erase(text.find_last_not_of(" \t\r") + 1);
+		};
+		
+		vector<BookingRequest> requests;
+		string line;
+		while (std::getline(file, line))
+		{
+			trim(line);
+			if (line.empty() || line[0] == '#')
+				continue;
 			
-			if (!FlightManager::getInstance()->releaseSeatForFlight(res->getFlightNumber(), res->getSeatNumber()))
-			{
-				throw ReservationException("Failed to reserve or release seat. Please try again.");
-			}
-
-			if (!FlightManager::getInstance()->reserveSeatForFlight(res->getFlightNumber(), newSeat))
+			// "alice, FL1" names the same booking as "alice,FL1"
+			BookingRequest request;
+			std::istringstream fields(line);
+			for (string* field : {&request.passengerUsername, &request.flightNumber, &request.seatNumber, &request.idempotencyKey,
+			                      &request.cabin})
 			{
-				// Rollback: re-reserve the old seat
-				FlightManager::getInstance()->reserveSeatForFlight(res->getFlightNumber(), res->getSeatNumber());
-				throw ReservationException("Failed to reserve or release seat. Please try again.");
+				std::getline(fields, *field, ',');
+				trim(*field);
 			}
-			
-			res->setSeatNumber(newSeat);
-			if (res->isCheckedIn()) res->setCheckedIn("");
-			saveReservationToDatabase(res);
-			ui->printSuccess("Reservation updated!");
+			requests.push_back(request);
 		}
-		else
+		
+		if (requests.empty())
+			throw ReservationException("No bookings found in " + path + ".");
+		
+		vector<BookingResult> results = createReservations(requests, agentUsername);
+		
+		vector<string> headers = {"Passenger", "Flight", "Seat", "Result"};
+		vector<vector<string>> rows;
+		std::unordered_set<string> booked;	// Retried lines repeat an earlier reservation
+		double totalCost = 0.0;
+		for (size_t i = 0; i < results.size(); ++i)
 		{
-			if (!ui->getYesNo("Cancel reservation?"))
+			if (results[i].success && booked.insert(results[i].reservationId).second)
 			{
-				ui->printWarning("Canceled.");
-				ui->pauseScreen();
-				return;
+				totalCost += results[i].cost;
 			}
-			
-			FlightManager::getInstance()->releaseSeatForFlight(res->getFlightNumber(), res->getSeatNumber());
-			
-			res->setStatus(ReservationStatus::CANCELED);
-			saveReservationToDatabase(res);
-			ui->printSuccess("Reservation canceled!");
+			rows.push_back({requests[i].passengerUsername, requests[i].flightNumber, results[i].seatNumber,
+			                results[i].success ? results[i].reservationId : results[i].error});
 		}
+		
+		ui->displayTable(headers, rows);
+		ui->println("\nBooked: " + std::to_string(booked.size()) + " of " + std::to_string(results.size()) +
+		            ", Total Cost: " + ui->formatCurrency(totalCost));
 	}
 	catch (const std::exception& e)
 	{ 
@@ -201,257 +400,1449 @@ void ReservationManager::updateOrCancel(bool isModify)
 	ui->pauseScreen();
 }
 
-// ==================== Check-In Operations ====================
-
-void ReservationManager::checkIn(const string& passengerUsername)
+vector<BookingResult> ReservationManager::createReservations(const vector<BookingRequest>& requests,
+                                                             const string& agentUsername)
 {
-	ui->clearScreen();
-	ui->printHeader("Check In");
+	vector<BookingResult> results(requests.size(), BookingResult{false, "", "", 0.0, ""});
+	FlightManager* flightManager = FlightManager::getInstance();
 	
-	try
+	// Every passenger is checked in one pass over the users table
+	vector<string> passengers;
+	passengers.reserve(requests.size());
+	for (const auto& request : requests)
 	{
-		auto res = loadReservationFromDatabase(ui->getString("Reservation ID: "));
-		if (!res) throw ReservationException("Reservation not found.");
-		if (res->getPassengerUsername() != passengerUsername)
-			throw ReservationException("You do not have access to this reservation.");
-		if (res->getStatus() != ReservationStatus::CONFIRMED)
-			throw ReservationException("Invalid status transition for this reservation.");
+		passengers.push_back(request.passengerUsername);
+	}
+	vector<bool> passengerExists = UsersManager::getInstance()->usersExist(passengers);
+	
+	// Keyed requests seen before return their first result; repeats within this batch follow
+	// the first request carrying the key
+	vector<string> scopedKeys(requests.size());
+	std::unordered_map<string, size_t> firstWithKey;
+	vector<bool> replayed(requests.size(), false);
+	for (size_t i = 0; i < requests.size(); ++i)
+	{
+		if (requests[i].idempotencyKey.empty())
+			continue;
 		
-		if (!res->isCheckedIn())
+		scopedKeys[i] = scopeIdempotencyKey(agentUsername, requests[i].idempotencyKey);
+		json previous;
+		if (idempotencyKeys->lookup(scopedKeys[i], previous))
 		{
-			res->setCheckedIn(getCurrentDateTime());
-			saveReservationToDatabase(res);
+			results[i] = bookingResultFromJson(previous);
+			replayed[i] = true;
+		}
+		else if (!firstWithKey.emplace(scopedKeys[i], i).second)
+		{
+			replayed[i] = true;
 		}
-		
-		ui->printSuccess("Checked in!");
-		displayBoardingPass(res);
 	}
-	catch (const std::exception& e)
-	{ 
-		ui->printError(string(e.what()));
+	
+	// Group by flight, keeping request order within each flight
+	std::unordered_map<string, vector<size_t>> byFlight;
+	vector<string> flightOrder;
+	for (size_t i = 0; i < requests.size(); ++i)
+	{
+		if (replayed[i])
+			continue;
+		
+		if (!passengerExists[i])
+		{
+			results[i].error = "Passenger not found in system.";
+			continue;
+		}
+		
+		vector<size_t>& group = byFlight[requests[i].flightNumber];
+		if (group.empty())
+			flightOrder.push_back(requests[i].flightNumber);
+		group.push_back(i);
 	}
 	
-	ui->pauseScreen();
-}
-
-void ReservationManager::viewBoardingPass(const string& passengerUsername)
-{
-	ui->clearScreen();
-	ui->printHeader("View Boarding Pass");
+	vector<size_t> booked;	// Requests holding a reserved seat, numbered once all flights are done
+	std::unordered_map<string, vector<string>> reservedSeats;	// Released again if the write fails
+	
+	for (const string& flight : flightOrder)
+	{
+		const vector<size_t>& group = byFlight[flight];
+		shared_ptr<Flight> flightObj = flightManager->flightExists(flight) ? flightManager->getFlight(flight) : nullptr;
+		if (!flightObj)
+		{
+			for (size_t i : group)
+				results[i].error = "Flight not found.";
+			continue;
+		}
+		
+		// Requests without a seat sit in the cabin they ask for, or the lead-in cabin they were quoted;
+		// each cabin's requests share one allocation pass over its free seats. Seats named elsewhere
+		// in the batch are kept out of that pass, so request order does not decide who gets them
+		const vector<FareBucket>& buckets = flightObj->getFareBuckets();
+		int leadInCabin = -1;
+		std::map<int, vector<size_t>> unassignedByCabin;
+		vector<string> requestedSeats;
+		for (size_t i : group)
+		{
+			if (!requests[i].seatNumber.empty())
+			{
+				results[i].seatNumber = requests[i].seatNumber;
+				requestedSeats.push_back(requests[i].seatNumber);
+				continue;
+			}
+			
+			if (requests[i].cabin.empty())
+			{
+				if (leadInCabin == -1)
+					leadInCabin = PricingEngine::getInstance()->getLeadInCabin(flightObj);
+				unassignedByCabin[leadInCabin].push_back(i);
+				continue;
+			}
+			
+			auto bucket = std::find_if(buckets.begin(), buckets.end(),
+				[&requests, i](const FareBucket& b) { return b.cabin == requests[i].cabin; });
+			if (bucket == buckets.end())
+				results[i].error = "Cabin " + requests[i].cabin + " not found.";
+			else
+				unassignedByCabin[static_cast<int>(bucket - buckets.begin())].push_back(i);
+		}
+		
+		for (const auto& [cabin, unassigned] : unassignedByCabin)
+		{
+			SeatPreferences preferences;
+			preferences.partySize = static_cast<int>(unassigned.size());
+			preferences.arrangement = GroupArrangement::ANYWHERE;
+			preferences.cabin = cabin;
+			preferences.partial = true;
+			
+			vector<string> seats = flightManager->findGroupSeats(flight, preferences, requestedSeats);
+			for (size_t k = 0; k < unassigned.size(); ++k)
+			{
+				if (k < seats.size())
+					results[unassigned[k]].seatNumber = seats[k];
+				else
+					results[unassigned[k]].error = cabin >= 0 ? buckets[cabin].cabin + " is fully booked." : "Flight is fully booked.";
+			}
+		}
+		
+		vector<size_t> seated;
+		vector<string> seatNumbers;
+		for (size_t i : group)
+		{
+			if (results[i].seatNumber.empty())
+				continue;
+			seated.push_back(i);
+			seatNumbers.push_back(results[i].seatNumber);
+		}
+		
+		// Quoted before the batch is sold, in request order, so each passenger pays the load they
+		// booked at; a seat lost to a concurrent booking was sold either way
+		vector<double> quotes = PricingEngine::getInstance()->quoteSeats(flightObj, seatNumbers);
+		vector<bool> reserved = flightManager->reserveAvailableSeats(flight, seatNumbers);
+		for (size_t k = 0; k < seated.size(); ++k)
+		{
+			size_t i = seated[k];
+			if (!reserved[k])
+			{
+				results[i].error = "Seat " + results[i].seatNumber + " is not available.";
+				continue;
+			}
+			
+			results[i].success = true;
+			results[i].cost = quotes[k];
+			reservedSeats[flight].push_back(results[i].seatNumber);
+			booked.push_back(i);
+		}
+	}
 	
 	try
 	{
-		auto res = loadReservationFromDatabase(ui->getString("Reservation ID: "));
-		if (!res) throw ReservationException("Reservation not found.");
-		if (res->getPassengerUsername() != passengerUsername)
-			throw ReservationException("You do not have access to this reservation.");
-		if (!res->isCheckedIn())
-			throw ReservationException("Invalid status transition for this reservation.");
+		// Numbers are claimed only for bookings that got a seat, so rejected lines leave no gaps
+		vector<shared_ptr<Reservation>> reservations;
+		string bookingDate = getCurrentDateTime();
+		int nextNumber = booked.empty() ? 0 : getNextReservationNumber(static_cast<int>(booked.size()));
+		for (size_t i : booked)
+		{
+			results[i].reservationId = "RES_" + std::to_string(nextNumber++);
+			reservations.push_back(shared_ptr<Reservation>(new Reservation(
+				results[i].reservationId, requests[i].passengerUsername, requests[i].flightNumber, results[i].seatNumber,
+				ReservationStatus::CONFIRMED, bookingDate, results[i].cost, agentUsername, false, "")));
+		}
+		
+		saveReservationsToDatabase(reservations);
+	}
+	catch (const std::exception& e)
+	{
+		for (const auto& [flight, seats] : reservedSeats)
+		{
+			flightManager->releaseSeatsForFlight(flight, seats);
+		}
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			if (results[i].success && !replayed[i])
+			{
+				results[i] = BookingResult{false, "", results[i].seatNumber, 0.0, string(e.what())};
+			}
+		}
+		return results;
+	}
+	
+	// Only successful bookings are remembered; a failed request may be retried for real
+	vector<std::pair<string, json>> keyedResults;
+	for (const auto& [scopedKey, i] : firstWithKey)
+	{
+		if (results[i].success)
+			keyedResults.emplace_back(scopedKey, bookingResultToJson(results[i]));
+	}
+	try
+	{
+		idempotencyKeys->recordAll(keyedResults);
+	}
+	catch (const std::exception& e)
+	{
+		// The bookings are saved; reporting them as failed would invite a retry that books twice
+		ui->printWarning("Could not record the request references: " + string(e.what()));
+	}
+	
+	// Repeats of a key within this batch share the first request's outcome
+	for (size_t i = 0; i < requests.size(); ++i)
+	{
+		auto it = scopedKeys[i].empty() ? firstWithKey.end() : firstWithKey.find(scopedKeys[i]);
+		if (it != firstWithKey.end() && it->second != i)
+			results[i] = results[it->second];
+	}
+	
+	return results;
+}
+
+string ReservationManager::createPromotedReservation(const string& passengerUsername, const string& flightNumber,
+                                                     const string& seatNumber, const string& agentUsername, double totalCost)
+{
+	string resId = "RES_" + std::to_string(getNextReservationNumber());
+	auto res = shared_ptr<Reservation>(new Reservation(
+		resId, passengerUsername, flightNumber, seatNumber, ReservationStatus::CONFIRMED,
+		getCurrentDateTime(), totalCost, agentUsername, false, ""));
+	
+	saveReservationToDatabase(res);
+	return resId;
+}
+
+void ReservationManager::cancelPromotedReservation(const string& reservationId)
+{
+	auto res = loadReservationFromDatabase(reservationId);
+	if (!res)
+		throw ReservationException("Reservation not found.");
+	
+	res->setStatus(ReservationStatus::CANCELED);
+	saveReservationToDatabase(res);
+}
+
+bool ReservationManager::hasConfirmedReservation(const string& passengerUsername, const string& flightNumber)
+{
+	// Archived reservations belong to completed flights, so only the hot table is searched
+	for (const auto& res : loadIndexedReservations(passengerIndex, passengerUsername))
+	{
+		if (res->getFlightNumber() == flightNumber && res->getStatus() == ReservationStatus::CONFIRMED)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ReservationManager::seatOverbookedPassenger(const string& flightNumber, const string& seatNumber)
+{
+	// Overbooked passengers paid the lead-in fare, so only a seat in its cabin is theirs to take
+	auto flightObj = FlightManager::getInstance()->getFlight(flightNumber);
+	if (!flightObj || flightObj->getSeatCabin(seatNumber) != PricingEngine::getInstance()->getLeadInCabin(flightObj))
+		return false;
+	
+	CapacityManager* capacityManager = CapacityManager::getInstance();
+	shared_ptr<Reservation> earliest;
+	UnseatedKey key;
+	while (!earliest && capacityManager->getFirstUnseated(flightNumber, key))
+	{
+		earliest = loadReservationFromDatabase(key.second);
+		
+		// Rows removed or changed outside the save path leave a stale entry; drop it and look again
+		if (!earliest || earliest->getStatus() != ReservationStatus::CONFIRMED || earliest->getSeatNumber() != UNASSIGNED_SEAT)
+		{
+			capacityManager->trackUnseated(flightNumber, key, false);
+			earliest = nullptr;
+		}
+	}
+	
+	if (!earliest)
+		return false;
+	
+	// The seat stays reserved in the inventory; it only changes hands. Saving takes it off the queue
+	earliest->setSeatNumber(seatNumber);
+	saveReservationToDatabase(earliest);
+	capacityManager->releaseOverbooking(flightNumber);
+	
+	ui->printSuccess("Seat " + seatNumber + " given to overbooked reservation " + earliest->getReservationId() + ".");
+	return true;
+}
+
+void ReservationManager::offerWaitlist(const string& passengerUsername, const string& flightNumber,
+                                       const string& agentUsername)
+{
+	ui->printWarning("Flight is fully booked.");
+	
+	WaitlistManager* waitlists = WaitlistManager::getInstance();
+	if (waitlists->isWaitlisted(flightNumber, passengerUsername))
+	{
+		ui->println("Passenger is already on the waitlist for this flight.");
+		return;
+	}
+	
+	// The waitlist sells the lead-in cabin at today's lead-in fare; a promotion charges exactly that
+	auto flightObj = FlightManager::getInstance()->getFlight(flightNumber);
+	int cabin = PricingEngine::getInstance()->getLeadInCabin(flightObj);
+	double fare = PricingEngine::getInstance()->quoteCabin(flightObj, cabin);
+	
+	if (cabin >= 0)
+		ui->println("Cabin: " + flightObj->getFareBuckets()[cabin].cabin);
+	ui->println("Fare if promoted: " + ui->formatCurrency(fare));
+	ui->println("Waitlist length: " + std::to_string(waitlists->getWaitlistLength(flightNumber, cabin)));
+	if (!ui->getYesNo("Join the waitlist?"))
+	{
+		ui->printWarning("Canceled.");
+		return;
+	}
+	
+	ui->displayMenu("Waitlist Priority", {
+		WaitlistManager::priorityToString(WaitlistPriority::STANDARD),
+		WaitlistManager::priorityToString(WaitlistPriority::FREQUENT_FLYER),
+		WaitlistManager::priorityToString(WaitlistPriority::PREMIUM)
+	});
+	auto priority = static_cast<WaitlistPriority>(ui->getChoice("Enter choice: ", 1, 3) - 1);
+	
+	size_t position = waitlists->join(flightNumber, passengerUsername, agentUsername, priority, cabin, fare);
+	ui->printSuccess("Passenger added to the waitlist.");
+	ui->println("Position: " + std::to_string(position) + ". A released seat is booked automatically.");
+}
+
+void ReservationManager::modifyReservation(const string& agentUsername)
+{
+	ui->clearScreen();
+	ui->printHeader("Modify Reservation");
+	updateOrCancel(true);
+}
+
+void ReservationManager::cancelReservation(const string& agentUsername)
+{
+	ui->clearScreen();
+	ui->printHeader("Cancel Reservation");
+	updateOrCancel(false);
+}
+
+void ReservationManager::updateOrCancel(bool isModify)
+{
+	try
+	{
+		auto res = loadReservationFromDatabase(ui->getString("Reservation ID: "));
+		if (!res) throw ReservationException("Reservation not found.");
+		if (res->getStatus() != ReservationStatus::CONFIRMED)
+			throw ReservationException("Invalid status transition for this reservation.");
+		
+		if (isModify)
+		{
+			ui->println("\nCurrent Seat: " + res->getSeatNumber());
+			
+			// The fare paid covers one cabin: the current seat's, or the lead-in cabin for an overbooked passenger
+			auto flightObj = FlightManager::getInstance()->getFlight(res->getFlightNumber());
+			if (!flightObj) throw ReservationException("Flight not found.");
+			int cabin = res->getSeatNumber() == UNASSIGNED_SEAT ? PricingEngine::getInstance()->getLeadInCabin(flightObj)
+			                                                    : flightObj->getSeatCabin(res->getSeatNumber());
+			if (cabin >= 0)
+				ui->println("Seats can be changed within the " + flightObj->getFareBuckets()[cabin].cabin + " cabin.");
+			
+			string newSeat = "";
+			uint64_t holdId = 0;
+			while (true)
+			{
+				newSeat = ui->getString("New seat number: ");
+				if (newSeat == res->getSeatNumber()) break;
+				if (cabin >= 0 && flightObj->getSeatCabin(newSeat) != cabin)
+				{
+					ui->printError("Seat is not in the " + flightObj->getFareBuckets()[cabin].cabin + " cabin.");
+					continue;
+				}
+				holdId = FlightManager::getInstance()->holdSeatForFlight(res->getFlightNumber(), newSeat);
+				if (holdId != 0) break;
+				ui->printError("Seat not available.");
+			}
+			
+			if (newSeat == res->getSeatNumber())
+			{
+				ui->printWarning("Same seat selected.");
+				ui->pauseScreen();
+				return;
+			}
+			
+			if (!ui->getYesNo("Change to " + newSeat + "?"))
+			{
+				FlightManager::getInstance()->releaseSeatHold(holdId);
+				ui->printWarning("Canceled.");
+				ui->pauseScreen();
+				return;
+			}
+			
+			// Commit the held seat first so the passenger is never left without one
+			if (!FlightManager::getInstance()->commitSeatHold(holdId))
+			{
+				throw ReservationException("Failed to reserve or release seat. Please try again.");
+			}
+			
+			// Saved before the old seat is released: the release can hand it straight to a waitlisted
+			// passenger, which must not happen while this reservation may still hold it
+			string oldSeat = res->getSeatNumber();
+			res->setSeatNumber(newSeat);
+			if (res->isCheckedIn()) res->setCheckedIn("");
+			try
+			{
+				saveReservationToDatabase(res);
+			}
+			catch (...)
+			{
+				FlightManager::getInstance()->releaseSeatsForFlight(res->getFlightNumber(), {newSeat});
+				throw;
+			}
+			
+			releaseReservedSeat(res->getFlightNumber(), oldSeat);
+			ui->printSuccess("Reservation updated!");
+		}
+		else
+		{
+			if (!ui->getYesNo("Cancel reservation?"))
+			{
+				ui->printWarning("Canceled.");
+				ui->pauseScreen();
+				return;
+			}
+			
+			// Canceled first, so a failed save never leaves the seat promoted to someone else as well
+			res->setStatus(ReservationStatus::CANCELED);
+			saveReservationToDatabase(res);
+			
+			releaseReservedSeat(res->getFlightNumber(), res->getSeatNumber());
+			ui->printSuccess("Reservation canceled!");
+		}
+	}
+	catch (const std::exception& e)
+	{ 
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+void ReservationManager::releaseReservedSeat(const string& flightNumber, const string& seatNumber)
+{
+	if (seatNumber == UNASSIGNED_SEAT)
+	{
+		CapacityManager::getInstance()->releaseOverbooking(flightNumber);
+	}
+	else
+	{
+		FlightManager::getInstance()->releaseSeatForFlight(flightNumber, seatNumber);
+	}
+}
+
+// ==================== Check-In Operations ====================
+
+void ReservationManager::checkIn(const string& passengerUsername)
+{
+	ui->clearScreen();
+	ui->printHeader("Check In");
+	
+	try
+	{
+		auto res = loadReservationFromDatabase(ui->getString("Reservation ID: "));
+		if (!res) throw ReservationException("Reservation not found.");
+		if (res->getPassengerUsername() != passengerUsername)
+			throw ReservationException("You do not have access to this reservation.");
+		if (res->getStatus() != ReservationStatus::CONFIRMED)
+			throw ReservationException("Invalid status transition for this reservation.");
+		
+		// Overbooked passengers paid the lead-in fare and get the first free seat of its cabin once one opens up
+		if (res->getSeatNumber() == UNASSIGNED_SEAT)
+		{
+			SeatPreferences preferences;
+			preferences.arrangement = GroupArrangement::ANYWHERE;
+			preferences.cabin = PricingEngine::getInstance()->getLeadInCabin(
+				FlightManager::getInstance()->getFlight(res->getFlightNumber()));
+			vector<string> seats = FlightManager::getInstance()->findGroupSeats(res->getFlightNumber(), preferences);
+			
+			if (seats.empty() || !FlightManager::getInstance()->reserveSeatsForFlight(res->getFlightNumber(), seats))
+				throw ReservationException("No seat is available yet. Please see a booking agent at the airport.");
+			
+			// The authorization is given back only once the reservation holds the seat on disk
+			res->setSeatNumber(seats.front());
+			try
+			{
+				saveReservationToDatabase(res);
+			}
+			catch (...)
+			{
+				FlightManager::getInstance()->releaseSeatsForFlight(res->getFlightNumber(), seats);
+				res->setSeatNumber(UNASSIGNED_SEAT);
+				throw;
+			}
+			CapacityManager::getInstance()->releaseOverbooking(res->getFlightNumber());
+			ui->printSuccess("Seat " + seats.front() + " assigned.");
+		}
+		
+		if (!res->isCheckedIn())
+		{
+			res->setCheckedIn(getCurrentDateTime());
+			saveReservationToDatabase(res);
+		}
+		
+		ui->printSuccess("Checked in!");
+		displayBoardingPass(res);
+	}
+	catch (const std::exception& e)
+	{ 
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+void ReservationManager::checkInFlight()
+{
+	ui->clearScreen();
+	ui->printHeader("Check In Flight");
+	
+	try
+	{
+		string flight = ui->getString("Flight number: ");
+		if (!FlightManager::getInstance()->flightExists(flight))
+			throw ReservationException("Flight not found.");
+		
+		if (!ui->getYesNo("Check in every confirmed passenger on " + flight + "?"))
+		{
+			ui->printWarning("Canceled.");
+			ui->pauseScreen();
+			return;
+		}
+		
+		BulkCheckInResult result = bulkCheckIn(flight);
+		
+		ui->printSuccess("Flight " + flight + " checked in.");
+		ui->println("Checked in now: " + std::to_string(result.checkedIn));
+		ui->println("Already checked in: " + std::to_string(result.alreadyCheckedIn));
+		if (result.seatsAssigned > 0)
+			ui->println("Seats assigned to overbooked passengers: " + std::to_string(result.seatsAssigned));
+		if (result.notSeated > 0)
+			ui->printWarning(std::to_string(result.notSeated) + " overbooked passenger(s) have no seat yet.");
+		if (!result.boardingPassFile.empty())
+			ui->println(std::to_string(result.boardingPasses) + " boarding passes written to: " + result.boardingPassFile);
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+BulkCheckInResult ReservationManager::bulkCheckIn(const string& flightNumber)
+{
+	FlightManager* flightManager = FlightManager::getInstance();
+	auto flight = flightManager->getFlight(flightNumber);
+	if (!flight)
+		throw ReservationException("Flight not found.");
+	
+	string status = flight->getStatus();
+	if (status == "Departed" || status == "Arrived" || status == "Completed" || status == "Canceled")
+		throw ReservationException("Check-in is closed for this flight.");
+	
+	BulkCheckInResult result;
+	vector<shared_ptr<Reservation>> confirmed;
+	vector<shared_ptr<Reservation>> unseated;
+	for (const auto& res : loadIndexedReservations(flightIndex, flightNumber))
+	{
+		if (res->getStatus() != ReservationStatus::CONFIRMED)
+			continue;
+		confirmed.push_back(res);
+		if (res->getSeatNumber() == UNASSIGNED_SEAT)
+			unseated.push_back(res);
+	}
+	
+	// The index returns IDs sorted as strings; seat overbooked passengers in the unseated queue's order
+	std::sort(unseated.begin(), unseated.end(), [](const shared_ptr<Reservation>& a, const shared_ptr<Reservation>& b)
+	{
+		return UnseatedOrder()(UnseatedKey{a->getBookingDate(), a->getReservationId()},
+		                       UnseatedKey{b->getBookingDate(), b->getReservationId()});
+	});
+	
+	// Overbooked passengers paid the lead-in fare; they share one allocation pass over its cabin
+	// and one seat write, in booking order
+	vector<shared_ptr<Reservation>> changed;
+	vector<string> assignedSeats;	// Released again if the write fails
+	if (!unseated.empty())
+	{
+		SeatPreferences preferences;
+		preferences.partySize = static_cast<int>(unseated.size());
+		preferences.arrangement = GroupArrangement::ANYWHERE;
+		preferences.cabin = PricingEngine::getInstance()->getLeadInCabin(flight);
+		preferences.partial = true;
+		
+		vector<string> seats = flightManager->findGroupSeats(flightNumber, preferences);
+		vector<bool> reserved = flightManager->reserveAvailableSeats(flightNumber, seats);
+		
+		size_t next = 0;
+		for (size_t i = 0; i < seats.size(); ++i)
+		{
+			if (!reserved[i])
+				continue;
+			
+			unseated[next]->setSeatNumber(seats[i]);
+			assignedSeats.push_back(seats[i]);
+			++next;
+		}
+		result.seatsAssigned = static_cast<int>(next);
+		result.notSeated = static_cast<int>(unseated.size() - next);
+	}
+	
+	string now = getCurrentDateTime();
+	vector<shared_ptr<Reservation>> boarding;
+	for (const auto& res : confirmed)
+	{
+		if (res->getSeatNumber() == UNASSIGNED_SEAT)
+			continue;
+		
+		if (res->isCheckedIn())
+		{
+			++result.alreadyCheckedIn;
+		}
+		else
+		{
+			res->setCheckedIn(now);
+			changed.push_back(res);
+			++result.checkedIn;
+		}
+		boarding.push_back(res);
+	}
+	
+	try
+	{
+		saveReservationsToDatabase(changed);
+	}
+	catch (const std::exception&)
+	{
+		// A failed batch write leaves the table unchanged: the seats go back and the overbooking authorizations stay held
+		flightManager->releaseSeatsForFlight(flightNumber, assignedSeats);
+		for (size_t i = 0; i < assignedSeats.size(); ++i)
+		{
+			unseated[i]->setSeatNumber(UNASSIGNED_SEAT);
+		}
+		throw;
+	}
+	
+	// Only seated reservations that were saved give their authorization back
+	for (size_t i = 0; i < assignedSeats.size(); ++i)
+	{
+		CapacityManager::getInstance()->releaseOverbooking(flightNumber);
+	}
+	
+	if (boarding.empty())
+	{
+		return result;
+	}
+	
+	// Names are looked up up front so the render workers only format strings
+	vector<string> passengerNames;
+	passengerNames.reserve(boarding.size());
+	UsersManager* usersManager = UsersManager::getInstance();
+	for (const auto& res : boarding)
+	{
+		try
+		{
+			passengerNames.push_back(usersManager->getUser(res->getPassengerUsername())->getName());
+		}
+		catch (const std::exception&)
+		{
+			passengerNames.push_back(res->getPassengerUsername());
+		}
+	}
+	
+	string gate = flight->getGate();
+	string boardingTime = flight->getBoardingTime();
+	vector<string> passes(boarding.size());
+	
+	size_t threadCount = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(),
+	                                                          boarding.size() / BOARDING_PASSES_PER_THREAD));
+	vector<std::thread> workers;
+	for (size_t t = 0; t < threadCount; ++t)
+	{
+		workers.emplace_back([&, t]() {
+			for (size_t i = boarding.size() * t / threadCount; i < boarding.size() * (t + 1) / threadCount; ++i)
+			{
+				passes[i] = renderBoardingPass(boarding[i], passengerNames[i], gate, boardingTime);
+			}
+		});
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	
+	// One pass per printed page, front row first ("12C" -> row 12, seat C)
+	vector<std::pair<std::pair<int, string>, size_t>> order;
+	for (size_t i = 0; i < boarding.size(); ++i)
+	{
+		const string& seat = boarding[i]->getSeatNumber();
+		size_t digits = seat.find_first_not_of("0123456789");
+		int row = digits > 0 ? std::stoi(seat.substr(0, digits)) : 0;
+		order.push_back({{row, digits == string::npos ? "" : seat.substr(digits)}, i});
+	}
+	std::sort(order.begin(), order.end());
+	
+	string filename = "BoardingPasses/" + flightNumber + "_" + now + ".txt";
+	std::replace(filename.begin(), filename.end(), ' ', '_');
+	std::replace(filename.begin(), filename.end(), ':', '-');
+	
+	try
+	{
+		std::filesystem::create_directories("BoardingPasses");
+	}
+	catch (const std::exception&)
+	{
+		throw ReservationException("Failed to create boarding pass file.");
+	}
+	
+	std::ofstream outFile(filename);
+	if (!outFile.is_open())
+		throw ReservationException("Failed to create boarding pass file.");
+	
+	for (size_t k = 0; k < order.size(); ++k)
+	{
+		if (k > 0)
+			outFile << "\n\f";
+		outFile << passes[order[k].second] << "\n";
+	}
+	outFile.close();
+	
+	result.boardingPasses = static_cast<int>(boarding.size());
+	result.boardingPassFile = filename;
+	return result;
+}
+
+void ReservationManager::viewBoardingPass(const string& passengerUsername)
+{
+	ui->clearScreen();
+	ui->printHeader("View Boarding Pass");
+	
+	try
+	{
+		auto res = loadReservationFromDatabase(ui->getString("Reservation ID: "));
+		if (!res) throw ReservationException("Reservation not found.");
+		if (res->getPassengerUsername() != passengerUsername)
+			throw ReservationException("You do not have access to this reservation.");
+		if (!res->isCheckedIn())
+			throw ReservationException("Invalid status transition for this reservation.");
+		
+		displayBoardingPass(res);
+	}
+	catch (const std::exception& e)
+	{ 
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+// ==================== Query Operations ====================
+
+void ReservationManager::viewReservations(const string& username, UserRole role)
+{
+	ui->clearScreen();
+	ui->printHeader("View Reservations");
+	
+	try
+	{
+		vector<shared_ptr<Reservation>> reservations;
+		
+		if (role == UserRole::PASSENGER)
+		{
+			reservations = getReservationsByPassenger(username);
+		}
+		else if (role == UserRole::BOOKING_AGENT)
+		{
+			vector<string> filters = {"All", "By Passenger", "By Flight", "My Bookings", "Back"};
+			ui->displayMenu("Filter", filters);
+			
+			switch (ui->getChoice("Choice: ", 1, 5))
+			{
+				case 1:
+					reservations = loadAllReservations();
+					break;
+				case 2:
+					reservations = getReservationsByPassenger(ui->getString("Passenger: "));
+					break;
+				case 3:
+					reservations = getReservationsByFlight(ui->getString("Flight: "));
+					break;
+				case 4:
+					reservations = getReservationsByAgent(username);
+					break;
+				case 5:
+					return;
+			}
+		}
+		
+		displayReservationsTable(reservations);
+	}
+	catch (const std::exception& e)
+	{ 
+		ui->printError(string(e.what()));
+	}
+	
+	ui->pauseScreen();
+}
+
+vector<shared_ptr<Reservation>> ReservationManager::getReservationsByPassenger(const string& passengerUsername)
+{
+	auto results = loadIndexedReservations(passengerIndex, passengerUsername);
+	appendArchived(results, archive->findByPassenger(passengerUsername));
+	return results;
+}
+
+vector<shared_ptr<Reservation>> ReservationManager::getReservationsByFlight(const string& flightNumber)
+{
+	auto results = loadIndexedReservations(flightIndex, flightNumber);
+	appendArchived(results, archive->findByFlight(flightNumber));
+	return results;
+}
+
+vector<shared_ptr<Reservation>> ReservationManager::getReservationsByAgent(const string& agentUsername)
+{
+	auto results = loadIndexedReservations(agentIndex, agentUsername);
+	appendArchived(results, archive->findByAgent(agentUsername));
+	return results;
+}
+
+vector<shared_ptr<Reservation>> ReservationManager::getAllReservations()
+{
+	// Full history for reports; the booking path never calls this
+	auto results = loadAllReservations();
+	appendArchived(results, archive->loadAll());
+	return results;
+}
+
+vector<shared_ptr<Reservation>> ReservationManager::loadAllReservations()
+{
+	vector<shared_ptr<Reservation>> results;
+	try
+	{
+		json allData = db->loadAll();
+		for (const auto& [id, data] : allData.items())
+		{
+			try
+			{
+				results.push_back(reservationFromJson(data));
+			}
+			catch (const std::exception&)
+			{
+				continue;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{ 
+		ui->printError("Error loading reservations: " + string(e.what()));
+	}
+	return results;
+}
+
+void ReservationManager::appendArchived(vector<shared_ptr<Reservation>>& results, const vector<json>& archived)
+{
+	if (archived.empty())
+	{
+		return;
+	}
+	
+	// A row archived by an interrupted move may still be hot, or be archived again into a follow-up
+	// partition; the hot copy wins, then the first archived one
+	std::unordered_set<string> seenIds;
+	for (const auto& res : results)
+	{
+		seenIds.insert(res->getReservationId());
+	}
+	
+	for (const auto& data : archived)
+	{
+		try
+		{
+			auto res = reservationFromJson(data);
+			if (seenIds.insert(res->getReservationId()).second)
+				results.push_back(res);
+		}
+		catch (const std::exception&)
+		{
+			continue;
+		}
+	}
+	
+	std::sort(results.begin(), results.end(),
+		[](const shared_ptr<Reservation>& a, const shared_ptr<Reservation>& b) { return a->getReservationId() < b->getReservationId(); });
+}
+
+bool ReservationManager::hasActiveReservations(const string& flightNumber)
+{
+	try
+	{
+		return ReservationManager::getInstance()->getActiveReservationCount(flightNumber) > 0;
+	}
+	catch (const std::exception&)
+	{ 
+		return true;
+	}
+}
+
+int ReservationManager::getActiveReservationCount(const string& flightNumber)
+{
+	std::lock_guard<std::mutex> lock(indexMutex);
+	buildIndexes();
+	
+	auto it = activeCounts.find(flightNumber);
+	return it != activeCounts.end() ? it->second : 0;
+}
+
+vector<shared_ptr<Reservation>> ReservationManager::loadIndexedReservations(
+	const std::unordered_multimap<string, string>& index, const string& key)
+{
+	vector<string> reservationIds;
+	{
+		std::lock_guard<std::mutex> lock(indexMutex);
+		buildIndexes();
+		
+		auto range = index.equal_range(key);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			reservationIds.push_back(it->second);
+		}
+	}
+	
+	// Same order as a full table scan
+	std::sort(reservationIds.begin(), reservationIds.end());
+	
+	vector<shared_ptr<Reservation>> results;
+	for (const string& reservationId : reservationIds)
+	{
+		try
+		{
+			auto res = loadReservationFromDatabase(reservationId);
+			if (res)
+				results.push_back(res);
+		}
+		catch (const std::exception&)
+		{
+			continue;
+		}
+	}
+	return results;
+}
+
+// ==================== Index Maintenance ====================
+
+void ReservationManager::buildIndexes()
+{
+	if (indexesBuilt)
+	{
+		return;
+	}
+	
+	clearIndexes();	// Drop anything left by a failed earlier build
+	try
+	{
+		json allData = db->loadAll();
+		for (const auto& [id, data] : allData.items())
+		{
+			bool active = data.value("status", -1) == static_cast<int>(ReservationStatus::CONFIRMED);
+			indexReservation(id, IndexedKeys{data.value("passengerUsername", ""), data.value("flightNumber", ""),
+			                                 data.value("bookedByAgent", ""), active});
+		}
+		indexesBuilt = true;
+	}
+	catch (const std::exception& e)
+	{
+		ui->printError("Error loading reservations: " + string(e.what()));
+	}
+}
+
+void ReservationManager::indexReservation(const string& reservationId, const IndexedKeys& keys)
+{
+	auto it = indexedKeys.find(reservationId);
+	if (it != indexedKeys.end())
+	{
+		const IndexedKeys& old = it->second;
+		if (old.passengerUsername == keys.passengerUsername && old.flightNumber == keys.flightNumber &&
+		    old.bookedByAgent == keys.bookedByAgent && old.active == keys.active)
+		{
+			return;
+		}
+		
+		unindexReservation(reservationId);
+	}
+	
+	passengerIndex.emplace(keys.passengerUsername, reservationId);
+	flightIndex.emplace(keys.flightNumber, reservationId);
+	agentIndex.emplace(keys.bookedByAgent, reservationId);
+	if (keys.active)
+	{
+		++activeCounts[keys.flightNumber];
+	}
+	indexedKeys[reservationId] = keys;
+}
+
+void ReservationManager::unindexReservation(const string& reservationId)
+{
+	auto it = indexedKeys.find(reservationId);
+	if (it == indexedKeys.end())
+	{
+		return;
+	}
+	
+	const IndexedKeys& old = it->second;
+	if (old.active && --activeCounts[old.flightNumber] == 0)
+	{
+		activeCounts.erase(old.flightNumber);
+	}
+	eraseIndexEntry(passengerIndex, old.passengerUsername, reservationId);
+	eraseIndexEntry(flightIndex, old.flightNumber, reservationId);
+	eraseIndexEntry(agentIndex, old.bookedByAgent, reservationId);
+	indexedKeys.erase(it);
+}
+
+void ReservationManager::clearIndexes()
+{
+	passengerIndex.clear();
+	flightIndex.clear();
+	agentIndex.clear();
+	indexedKeys.clear();
+	activeCounts.clear();
+	indexesBuilt = false;
+}
+
+vector<ReservationCountMismatch> ReservationManager::verifyActiveReservationCounts()
+{
+	std::lock_guard<std::mutex> lock(indexMutex);
+	buildIndexes();
+	
+	// Recount from the stored rows, independently of the index code path
+	std::unordered_map<string, int> actualCounts;
+	json allData = db->loadAll();
+	for (const auto& [id, data] : allData.items())
+	{
+		if (data.value("status", -1) == static_cast<int>(ReservationStatus::CONFIRMED))
+		{
+			++actualCounts[data.value("flightNumber", "")];
+		}
+	}
+	
+	vector<ReservationCountMismatch> mismatches;
+	for (const auto& [flightNumber, actual] : actualCounts)
+	{
+		auto it = activeCounts.find(flightNumber);
+		int counted = it != activeCounts.end() ? it->second : 0;
+		if (counted != actual)
+		{
+			mismatches.push_back(ReservationCountMismatch{flightNumber, counted, actual});
+		}
+	}
+	for (const auto& [flightNumber, counted] : activeCounts)
+	{
+		if (actualCounts.find(flightNumber) == actualCounts.end())
+		{
+			mismatches.push_back(ReservationCountMismatch{flightNumber, counted, 0});
+		}
+	}
+	
+	std::sort(mismatches.begin(), mismatches.end(),
+		[](const ReservationCountMismatch& a, const ReservationCountMismatch& b) { return a.flightNumber < b.flightNumber; });
+	return mismatches;
+}
+
+void ReservationManager::rebuildIndexes()
+{
+	std::lock_guard<std::mutex> lock(indexMutex);
+	clearIndexes();
+	buildIndexes();
+}
+
+void ReservationManager::eraseIndexEntry(std::unordered_multimap<string, string>& index, const string& key,
+                                         const string& reservationId)
+{
+	auto range = index.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second == reservationId)
+		{
+			index.erase(it);
+			return;
+		}
+	}
+}
+
+// ==================== Database Operations ====================
+
+shared_ptr<Reservation> ReservationManager::loadReservationFromDatabase(const string& reservationId)
+{
+	if (!db->entryExists(reservationId)) return nullptr;
+	try
+	{
+		return reservationFromJson(db->getEntry(reservationId));
+	}
+	catch (const std::exception&)
+	{
+		throw ReservationException("Database error occurred while processing reservation.");
+	}
+}
+
+void ReservationManager::saveReservationToDatabase(const shared_ptr<Reservation>& reservation)
+{
+	if (!reservation) throw ReservationException("Database error occurred while processing reservation.");
+	try
+	{
+		json data = reservationToJson(reservation);
+		bool exists = db->entryExists(reservation->getReservationId());
+		json before = exists ? db->getEntry(reservation->getReservationId()) : json();
+		
+		// Write-ahead: the log never misses a committed row, and a failed append leaves the table untouched.
+		// A failed table write is compensated, so the log never keeps a change the table does not have.
+		recordEvents({{before, data}});
+		try
+		{
+			if (exists)
+			{
+				db->updateEntry(reservation->getReservationId(), data);
+			}
+			else
+			{
+				db->addEntry(reservation->getReservationId(), data);
+			}
+		}
+		catch (const DatabaseException&)
+		{
+			abortEvents({{before, data}});
+			throw;
+		}
 		
-		displayBoardingPass(res);
+		// Before the first lookup the index is built from the database, which already has this row
+		{
+			std::lock_guard<std::mutex> lock(indexMutex);
+			if (indexesBuilt)
+			{
+				indexReservation(reservation->getReservationId(),
+				                 IndexedKeys{reservation->getPassengerUsername(), reservation->getFlightNumber(),
+				                             reservation->getBookedByAgent(),
+				                             reservation->getStatus() == ReservationStatus::CONFIRMED});
+			}
+		}
+		trackUnseated({{before, data}});
 	}
-	catch (const std::exception& e)
-	{ 
-		ui->printError(string(e.what()));
+	catch (const DatabaseException&)
+	{
+		throw ReservationException("Database error occurred while processing reservation.");
 	}
-	
-	ui->pauseScreen();
 }
 
-// ==================== Query Operations ====================
-
-void ReservationManager::viewReservations(const string& username, UserRole role)
+void ReservationManager::saveReservationsToDatabase(const vector<shared_ptr<Reservation>>& reservations)
 {
-	ui->clearScreen();
-	ui->printHeader("View Reservations");
+	json entries = json::object();
+	vector<string> reservationIds;
+	for (const auto& reservation : reservations)
+	{
+		if (!reservation) throw ReservationException("Database error occurred while processing reservation.");
+		entries[reservation->getReservationId()] = reservationToJson(reservation);
+		reservationIds.push_back(reservation->getReservationId());
+	}
 	
+	vector<std::pair<json, json>> changes;
 	try
 	{
-		vector<shared_ptr<Reservation>> reservations;
+		vector<bool> existing = db->entriesExist(reservationIds);
+		for (size_t i = 0; i < reservationIds.size(); ++i)
+		{
+			changes.emplace_back(existing[i] ? db->getEntry(reservationIds[i]) : json(), entries[reservationIds[i]]);
+		}
 		
-		if (role == UserRole::PASSENGER)
+		// Write-ahead and compensated, as in saveReservationToDatabase
+		recordEvents(changes);
+		try
 		{
-			reservations = getReservationsByPassenger(username);
+			db->upsertEntries(entries);
 		}
-		else if (role == UserRole::BOOKING_AGENT)
+		catch (const DatabaseException&)
 		{
-			vector<string> filters = {"All", "By Passenger", "By Flight", "My Bookings", "Back"};
-			ui->displayMenu("Filter", filters);
-			
-			switch (ui->getChoice("Choice: ", 1, 5))
-			{
-				case 1:
-					reservations = loadAllReservations();
-					break;
-				case 2:
-					reservations = getReservationsByPassenger(ui->getString("Passenger: "));
-					break;
-				case 3:
-					reservations = getReservationsByFlight(ui->getString("Flight: "));
-					break;
-				case 4:
-				{
-					reservations = loadAllReservations();
-					auto it = std::remove_if(reservations.begin(), reservations.end(),
-						[&username](const shared_ptr<Reservation>& r) { return r->getBookedByAgent() != username; });
-					reservations.erase(it, reservations.end());
-					break;
-				}
-				case 5:
-					return;
-			}
+			abortEvents(changes);
+			throw;
 		}
-		
-		displayReservationsTable(reservations);
 	}
-	catch (const std::exception& e)
-	{ 
-		ui->printError(string(e.what()));
+	catch (const DatabaseException&)
+	{
+		throw ReservationException("Database error occurred while processing reservation.");
 	}
 	
-	ui->pauseScreen();
-}
-
-vector<shared_ptr<Reservation>> ReservationManager::getReservationsByPassenger(const string& passengerUsername)
-{
-	vector<shared_ptr<Reservation>> results;
-	try
 	{
-		json allData = db->loadAll();
-		for (const auto& [id, data] : allData.items())
+		std::lock_guard<std::mutex> lock(indexMutex);
+		if (indexesBuilt)
 		{
-			try
-			{
-				auto res = reservationFromJson(data);
-				if (res->getPassengerUsername() == passengerUsername)
-					results.push_back(res);
-			}
-			catch (const std::exception&)
+			for (const auto& reservation : reservations)
 			{
-				continue;
+				indexReservation(reservation->getReservationId(),
+				                 IndexedKeys{reservation->getPassengerUsername(), reservation->getFlightNumber(),
+				                             reservation->getBookedByAgent(),
+				                             reservation->getStatus() == ReservationStatus::CONFIRMED});
 			}
 		}
 	}
-	catch (const std::exception& e)
-	{ 
-		ui->printError("Error loading reservations: " + string(e.what()));
-	}
-	return results;
+	trackUnseated(changes);
 }
 
-vector<shared_ptr<Reservation>> ReservationManager::getReservationsByFlight(const string& flightNumber)
+void ReservationManager::recordEvents(const vector<std::pair<json, json>>& changes)
 {
-	vector<shared_ptr<Reservation>> results;
-	try
+	vector<ReservationEvent> events;
+	string now = getCurrentDateTime();
+	for (const auto& [before, after] : changes)
 	{
-		json allData = db->loadAll();
-		for (const auto& [id, data] : allData.items())
+		ReservationEvent event;
+		if (ReservationEventLog::describeChange(before, after, event))
 		{
-			try
-			{
-				auto res = reservationFromJson(data);
-				if (res->getFlightNumber() == flightNumber)
-					results.push_back(res);
-			}
-			catch (const std::exception&)
-			{
-				continue;
-			}
+			event.recordedAt = now;
+			events.push_back(std::move(event));
 		}
 	}
-	catch (const std::exception& e)
-	{ 
-		ui->printError("Error loading reservations: " + string(e.what()));
-	}
-	return results;
+	
+	eventLog->append(events);
 }
 
-vector<shared_ptr<Reservation>> ReservationManager::getAllReservations()
+void ReservationManager::abortEvents(const vector<std::pair<json, json>>& changes)
 {
-	return loadAllReservations();
+	vector<ReservationEvent> events;
+	string now = getCurrentDateTime();
+	for (const auto& [before, after] : changes)
+	{
+		ReservationEvent event;
+		if (ReservationEventLog::describeAbort(before, after, event))
+		{
+			event.recordedAt = now;
+			events.push_back(std::move(event));
+		}
+	}
+	
+	try
+	{
+		eventLog->append(events);
+	}
+	catch (const DatabaseException& e)
+	{
+		// The table write already failed; that is the error the caller reports
+		ui->printError("Could not record the aborted reservation change: " + string(e.what()));
+	}
 }
 
-vector<shared_ptr<Reservation>> ReservationManager::loadAllReservations()
+void ReservationManager::trackUnseated(const vector<std::pair<json, json>>& changes)
 {
-	vector<shared_ptr<Reservation>> results;
-	try
+	auto isUnseated = [](const json& data)
 	{
-		json allData = db->loadAll();
-		for (const auto& [id, data] : allData.items())
+		return data.is_object() && data.value("status", -1) == static_cast<int>(ReservationStatus::CONFIRMED) &&
+		       data.value("seatNumber", "") == UNASSIGNED_SEAT;
+	};
+	
+	CapacityManager* capacityManager = CapacityManager::getInstance();
+	for (const auto& [before, after] : changes)
+	{
+		bool was = isUnseated(before);
+		bool is = isUnseated(after);
+		if (was && (!is || before.value("flightNumber", "") != after.value("flightNumber", "")))
 		{
-			try
-			{
-				results.push_back(reservationFromJson(data));
-			}
-			catch (const std::exception&)
-			{
-				continue;
-			}
+			capacityManager->trackUnseated(before.value("flightNumber", ""),
+			                               UnseatedKey{before.value("bookingDate", ""), before.value("reservationId", "")}, false);
+		}
+		if (is)
+		{
+			capacityManager->trackUnseated(after.value("flightNumber", ""),
+			                               UnseatedKey{after.value("bookingDate", ""), after.value("reservationId", "")}, true);
 		}
 	}
-	catch (const std::exception& e)
-	{ 
-		ui->printError("Error loading reservations: " + string(e.what()));
-	}
-	return results;
 }
 
-bool ReservationManager::hasActiveReservations(const string& flightNumber)
+// ==================== Event History ====================
+
+void ReservationManager::snapshotReservations()
 {
 	try
 	{
-		json allData = ReservationManager::getInstance()->db->loadAll();
-		for (const auto& [id, data] : allData.items())
-		{
-			try
-			{
-				auto res = ReservationManager::getInstance()->reservationFromJson(data);
-				if (res->getFlightNumber() == flightNumber && res->getStatus() == ReservationStatus::CONFIRMED)
-					return true;
-			}
-			catch (const std::exception&)
-			{
-				continue;
-			}
-		}
+		// Position first: anything appended while the table is read is replayed on top of it
+		EventLogPosition position = eventLog->getPosition();
+		eventLog->writeSnapshot(position, db->loadAll());
 	}
-	catch (const std::exception&)
-	{ 
-		return true;
+	catch (const DatabaseException& e)
+	{
+		ui->printError(string(e.what()));
 	}
-	return false;
 }
 
-// ==================== Database Operations ====================
+ReplayResult ReservationManager::replayEventLog()
+{
+	return eventLog->replay();
+}
 
-shared_ptr<Reservation> ReservationManager::loadReservationFromDatabase(const string& reservationId)
+vector<string> ReservationManager::findDivergentReservations(const json& replayed)
+{
+	vector<string> divergent;
+	json allData = db->loadAll();
+	
+	for (const auto& [reservationId, data] : allData.items())
+	{
+		if (!replayed.contains(reservationId) || replayed[reservationId] != data)
+			divergent.push_back(reservationId);
+	}
+	
+	for (const auto& [reservationId, data] : replayed.items())
+	{
+		if (!allData.contains(reservationId))
+			divergent.push_back(reservationId);
+	}
+	
+	std::sort(divergent.begin(), divergent.end());
+	return divergent;
+}
+
+void ReservationManager::restoreReservations(const json& replayed)
 {
-	if (!db->entryExists(reservationId)) return nullptr;
 	try
 	{
-		return reservationFromJson(db->getEntry(reservationId));
+		db->saveAll(replayed);
 	}
-	catch (const std::exception&)
+	catch (const DatabaseException&)
 	{
 		throw ReservationException("Database error occurred while processing reservation.");
 	}
+	
+	rebuildIndexes();
+	snapshotReservations();
 }
 
-void ReservationManager::saveReservationToDatabase(const shared_ptr<Reservation>& reservation)
+// ==================== Completion & Archival ====================
+
+size_t ReservationManager::completeReservations(const vector<string>& flightNumbers)
 {
-	if (!reservation) throw ReservationException("Database error occurred while processing reservation.");
+	vector<shared_ptr<Reservation>> completed;
+	for (const string& flightNumber : flightNumbers)
+	{
+		for (const auto& res : loadIndexedReservations(flightIndex, flightNumber))
+		{
+			if (res->getStatus() != ReservationStatus::CONFIRMED)
+				continue;
+			res->setStatus(ReservationStatus::COMPLETED);
+			completed.push_back(res);
+		}
+	}
+	
+	saveReservationsToDatabase(completed);
+	return completed.size();
+}
+
+size_t ReservationManager::archiveCompletedFlights()
+{
+	// Completed and canceled flights are closed out; their reservations no longer change. Their rows
+	// wait in the hot table until the month is sealed, so the partition is written once instead of per
+	// flight. Sealing goes by the calendar alone: a flight that never closes cannot hold a month open
+	std::time_t cutoff = std::time(nullptr) - static_cast<std::time_t>(ARCHIVE_GRACE_DAYS) * 86400;
+	std::stringstream ss;
+	ss << std::put_time(std::localtime(&cutoff), "%Y-%m");
+	string sealedBefore = ss.str();
+	
+	std::unordered_map<string, string> partitions;	// flight -> partition of its sealed departure month
+	std::unordered_map<string, string> monthPartitions;
+	for (const auto& flight : FlightManager::getInstance()->getAllFlights())
+	{
+		if (!flight || (flight->getStatus() != "Completed" && flight->getStatus() != "Canceled"))
+			continue;
+		
+		string month = ReservationArchive::getPartitionKey(flight->getDepartureDateTime());
+		if (month >= sealedBefore)
+			continue;
+		
+		// A month already archived is not rewritten for a flight that closed after it was sealed
+		auto it = monthPartitions.find(month);
+		if (it == monthPartitions.end())
+			it = monthPartitions.emplace(month, archive->hasPartition(month) ? month + ARCHIVE_LATE_SUFFIX : month).first;
+		partitions[flight->getFlightNumber()] = it->second;
+	}
+	
+	if (partitions.empty())
+	{
+		return 0;
+	}
+	
+	std::lock_guard<std::mutex> lock(indexMutex);
+	buildIndexes();
+	
+	std::unordered_map<string, json> byPartition;	// partition -> {reservation ID: record}
+	vector<string> reservationIds;
+	vector<ReservationEvent> events;
+	string now = getCurrentDateTime();
+	
+	for (const auto& [flightNumber, partition] : partitions)
+	{
+		auto range = flightIndex.equal_range(flightNumber);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			reservationIds.push_back(it->second);
+			events.push_back(ReservationEvent{0, ReservationEventType::ARCHIVED, it->second, flightNumber, now,
+			                                  json{{"partition", partition}}});
+		}
+	}
+	
+	if (reservationIds.empty())
+	{
+		return 0;
+	}
+	
 	try
 	{
-		json data = reservationToJson(reservation);
-		if (db->entryExists(reservation->getReservationId()))
-			db->updateEntry(reservation->getReservationId(), data);
-		else
-			db->addEntry(reservation->getReservationId(), data);
+		vector<std::pair<json, json>> removals;
+		for (const string& reservationId : reservationIds)
+		{
+			json data = db->getEntry(reservationId);
+			byPartition[partitions[data.value("flightNumber", "")]][reservationId] = data;
+			removals.emplace_back(std::move(data), json());
+		}
+		
+		// Cold copies are complete before the hot rows go
+		for (const auto& [partition, reservations] : byPartition)
+		{
+			archive->archive(partition, reservations);
+		}
+		
+		// Write-ahead and compensated, as in saveReservationsToDatabase
+		eventLog->append(events);
+		try
+		{
+			db->deleteEntries(reservationIds);
+		}
+		catch (const DatabaseException&)
+		{
+			abortEvents(removals);
+			throw;
+		}
 	}
 	catch (const DatabaseException&)
 	{
 		throw ReservationException("Database error occurred while processing reservation.");
 	}
+	
+	for (const string& reservationId : reservationIds)
+	{
+		unindexReservation(reservationId);
+	}
+	
+	return reservationIds.size();
 }
 
 // ==================== JSON Serialization ====================
@@ -481,6 +1872,29 @@ shared_ptr<Reservation> ReservationManager::reservationFromJson(const json& data
 		data["isCheckedIn"], data["checkInDate"]));
 }
 
+json ReservationManager::bookingResultToJson(const BookingResult& result)
+{
+	json data;
+	data["success"] = result.success;
+	data["reservationId"] = result.reservationId;
+	data["seatNumber"] = result.seatNumber;
+	data["cost"] = result.cost;
+	data["error"] = result.error;
+	return data;
+}
+
+BookingResult ReservationManager::bookingResultFromJson(const json& data)
+{
+	return BookingResult{data.value("success", false), data.value("reservationId", ""), data.value("seatNumber", ""),
+	                     data.value("cost", 0.0), data.value("error", "")};
+}
+
+string ReservationManager::scopeIdempotencyKey(const string& agentUsername, const string& key)
+{
+	// Keys are client-chosen, so two agents may pick the same one
+	return agentUsername + "/" + key;
+}
+
 // ==================== Display Helpers ====================
 
 void ReservationManager::displayReservationsTable(const vector<shared_ptr<Reservation>>& reservations)
@@ -529,20 +1943,77 @@ void ReservationManager::displayBoardingPass(const shared_ptr<Reservation>& res)
 	
 	auto flight = FlightManager::getInstance()->getFlight(res->getFlightNumber());
 	
-	ui->println("\n" + string(50, '='));
-	ui->println("            BOARDING PASS");
-	ui->println(string(50, '='));
-	ui->println("");
-	ui->println("  Passenger: " + passengerName);
-	ui->println("  Flight: " + res->getFlightNumber());
-	ui->println("  Seat: " + res->getSeatNumber());
-	ui->println("  Gate: " + flight->getGate());
-	ui->println("  Boarding Time: " + flight->getBoardingTime());
-	ui->println("  Check-In Date: " + res->getCheckInDate());
-	ui->println("");
-	ui->println(string(50, '='));
-	ui->println("  Please arrive at gate 30 minutes before boarding");
-	ui->println(string(50, '='));
+	ui->println("\n" + renderBoardingPass(res, passengerName, flight->getGate(), flight->getBoardingTime()));
+}
+
+string ReservationManager::renderBoardingPass(const shared_ptr<Reservation>& res, const string& passengerName,
+                                              const string& gate, const string& boardingTime)
+{
+	std::ostringstream oss;
+	oss << string(50, '=') << "\n";
+	oss << "            BOARDING PASS\n";
+	oss << string(50, '=') << "\n";
+	oss << "\n";
+	oss << "  Passenger: " << passengerName << "\n";
+	oss << "  Flight: " << res->getFlightNumber() << "\n";
+	oss << "  Seat: " << res->getSeatNumber() << "\n";
+	oss << "  Gate: " << gate << "\n";
+	oss << "  Boarding Time: " << boardingTime << "\n";
+	oss << "  Check-In Date: " << res->getCheckInDate() << "\n";
+	oss << "\n";
+	oss << string(50, '=') << "\n";
+	oss << "  Please arrive at gate 30 minutes before boarding\n";
+	oss << string(50, '=');
+	return oss.str();
+}
+
+int ReservationManager::getNextReservationNumber(int count)
+{
+	std::lock_guard<std::mutex> lock(sequenceMutex);
+	try
+	{
+		// Numbers are claimed before any row uses them, so a failed or deleted booking leaves a gap, never a repeat
+		int next = sequenceDb->getEntry("next").value("value", 1);
+		sequenceDb->journalEntry("next", json{{"value", next + std::max(count, 1)}});
+		return next;
+	}
+	catch (const DatabaseException&)
+	{
+		throw ReservationException("Database error occurred while processing reservation.");
+	}
+}
+
+void ReservationManager::seedReservationSequence()
+{
+	if (sequenceDb->entryExists("next"))
+		return;
+	
+	// Hot rows may have been deleted, so the highest hot ID counts as well as the totals
+	int next = db->getEntryCount() + static_cast<int>(archive->getArchivedCount()) + 1;
+	json allData = db->loadAll();
+	for (const auto& [reservationId, data] : allData.items())
+	{
+		if (reservationId.rfind("RES_", 0) == 0)
+		{
+			try
+			{
+				next = std::max(next, std::stoi(reservationId.substr(4)) + 1);
+			}
+			catch (const std::exception&)
+			{
+				// Not a generated ID
+			}
+		}
+	}
+	
+	try
+	{
+		sequenceDb->addEntry("next", json{{"value", next}});
+	}
+	catch (const DatabaseException& e)
+	{
+		ui->printError("Could not create the reservation sequence: " + string(e.what()));
+	}
 }
 
 string ReservationManager::getCurrentDateTime() const
@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include "WaitlistManager.hpp"
+#include "ReservationManager.hpp"
+#include "FlightManager.hpp"
+#include "PricingEngine.hpp"
+
+// Static member initialization
+WaitlistManager* WaitlistManager::instance = nullptr;
+
+// ==================== Waitlist Order ====================
+
+bool WaitlistOrder::operator()(const WaitlistEntry& a, const WaitlistEntry& b) const noexcept
+{
+	if (a.priority != b.priority)
+	{
+		return a.priority > b.priority;
+	}
+	return a.sequence < b.sequence;
+}
+
+// ==================== Constructor & Singleton ====================
+
+WaitlistManager::WaitlistManager()
+{
+	db = std::make_unique<Database>("Waitlists");
+	ui = UserInterface::getInstance();
+	loadWaitlists();
+}
+
+WaitlistManager* WaitlistManager::getInstance()
+{
+	if (instance == nullptr)
+	{
+		instance = new WaitlistManager();
+	}
+	return instance;
+}
+
+// ==================== Queue Operations ====================
+
+size_t WaitlistManager::join(const string& flightNumber, const string& passengerUsername, const string& agentUsername,
+                             WaitlistPriority priority, int cabin, double quotedFare)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	FlightWaitlist& waitlist = waitlists[flightNumber];
+	if (waitlist.byPassenger.find(passengerUsername) != waitlist.byPassenger.end())
+	{
+		throw ReservationException("Passenger is already on the waitlist for this flight.");
+	}
+	
+	auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	std::stringstream ss;
+	ss << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M");
+	
+	WaitlistEntry entry{waitlist.nextSequence, passengerUsername, agentUsername, priority, ss.str(), cabin, quotedFare};
+	persistEntry(flightNumber, entry);
+	
+	insertEntry(waitlist, entry);
+	++waitlist.nextSequence;
+	
+	// The newest entry is last in its tier, so its position is the size of its tier and every higher one
+	const CabinWaitlist& cabinWaitlist = waitlist.cabins[cabin];
+	size_t position = 0;
+	for (int tier = static_cast<int>(priority); tier < 3; ++tier)
+	{
+		position += cabinWaitlist.tierCounts[tier];
+	}
+	return position;
+}
+
+bool WaitlistManager::isWaitlisted(const string& flightNumber, const string& passengerUsername)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	auto it = waitlists.find(flightNumber);
+	return it != waitlists.end() && it->second.byPassenger.find(passengerUsername) != it->second.byPassenger.end();
+}
+
+size_t WaitlistManager::getWaitlistLength(const string& flightNumber, int cabin)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	auto it = waitlists.find(flightNumber);
+	if (it == waitlists.end())
+	{
+		return 0;
+	}
+	
+	auto cabinIt = it->second.cabins.find(cabin);
+	return cabinIt != it->second.cabins.end() ? cabinIt->second.queue.size() : 0;
+}
+
+// ==================== Promotion ====================
+
+bool WaitlistManager::promoteNext(const string& flightNumber, const string& seatNumber)
+{
+	// Once boarding has started (or the flight is gone) the seat goes back to the pool instead
+	shared_ptr<Flight> flight = FlightManager::getInstance()->getFlight(flightNumber);
+	if (!flight || (flight->getStatus() != "Scheduled" && flight->getStatus() != "Delayed"))
+	{
+		return false;
+	}
+	
+	// Entries from before cabins were recorded were quoted the lead-in fare
+	int seatCabin = flight->getSeatCabin(seatNumber);
+	vector<int> cabins = {seatCabin};
+	if (seatCabin >= 0 && seatCabin == PricingEngine::getInstance()->getLeadInCabin(flight))
+	{
+		cabins.push_back(-1);
+	}
+	
+	ReservationManager* reservationManager = ReservationManager::getInstance();
+	
+	// The head is claimed under the lock and booked without it, so the other managers never wait on the queue
+	WaitlistEntry head;
+	while (true)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			
+			auto it = waitlists.find(flightNumber);
+			if (it == waitlists.end())
+			{
+				return false;
+			}
+			
+			const WaitlistEntry* next = nullptr;
+			for (int cabin : cabins)
+			{
+				auto cabinIt = it->second.cabins.find(cabin);
+				if (cabinIt == it->second.cabins.end() || cabinIt->second.queue.empty())
+					continue;
+				
+				const WaitlistEntry& cabinHead = *cabinIt->second.queue.begin();
+				if (!next || WaitlistOrder()(cabinHead, *next))
+					next = &cabinHead;
+			}
+			
+			if (!next)
+			{
+				return false;
+			}
+			
+			head = *next;
+			eraseEntry(it->second, head.passengerUsername);
+		}
+		
+		// An entry left behind by an earlier promotion whose removal was never recorded
+		if (!reservationManager->hasConfirmedReservation(head.passengerUsername, flightNumber))
+		{
+			break;
+		}
+		
+		try
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			persistRemoval(flightNumber, head.sequence);
+		}
+		catch (const std::exception& e)
+		{
+			ui->printError(string(e.what()));
+		}
+	}
+	
+	string reservationId;
+	try
+	{
+		// The seat is still reserved in the inventory; it changes hands without returning to the pool
+		double fare = head.quotedFare > 0 ? head.quotedFare : PricingEngine::getInstance()->quoteSeat(flight, seatNumber);
+		reservationId = reservationManager->createPromotedReservation(
+			head.passengerUsername, flightNumber, seatNumber, head.agentUsername, fare);
+	}
+	catch (const std::exception& e)
+	{
+		restoreEntry(flightNumber, head);
+		ui->printError("Waitlist promotion failed: " + string(e.what()));
+		return false;
+	}
+	
+	try
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		persistRemoval(flightNumber, head.sequence);
+	}
+	catch (const std::exception& e)
+	{
+		// The entry is still on disk; undo the reservation so a restart cannot promote the passenger twice
+		ui->printError("Waitlist promotion failed: " + string(e.what()));
+		try
+		{
+			reservationManager->cancelPromotedReservation(reservationId);
+		}
+		catch (const std::exception& undoError)
+		{
+			// The reservation stands; the stale entry is dropped when it next reaches the head
+			ui->printError("Could not undo reservation " + reservationId + ": " + string(undoError.what()));
+			return true;
+		}
+		restoreEntry(flightNumber, head);
+		return false;
+	}
+	
+	ui->printSuccess("Seat " + seatNumber + " given to waitlisted passenger " + head.passengerUsername +
+	                 " (" + reservationId + ").");
+	return true;
+}
+
+string WaitlistManager::priorityToString(WaitlistPriority priority)
+{
+	switch (priority)
+	{
+		case WaitlistPriority::PREMIUM: return "Premium";
+		case WaitlistPriority::FREQUENT_FLYER: return "Frequent Flyer";
+		default: return "Standard";
+	}
+}
+
+// ==================== Helper Methods ====================
+
+void WaitlistManager::loadWaitlists()
+{
+	json allData = db->loadAll();
+	for (const auto& [flightNumber, data] : allData.items())
+	{
+		FlightWaitlist& waitlist = waitlists[flightNumber];
+		waitlist.nextSequence = data.value("nextSequence", uint64_t(1));
+		
+		if (!data.contains("entries"))
+		{
+			continue;
+		}
+		
+		for (const auto& [key, entryData] : data["entries"].items())
+		{
+			WaitlistEntry entry{std::stoull(key), entryData.value("passengerUsername", ""),
+			                    entryData.value("agentUsername", ""),
+			                    static_cast<WaitlistPriority>(entryData.value("priority", 0)),
+			                    entryData.value("requestedAt", ""), entryData.value("cabin", -1),
+			                    entryData.value("quotedFare", 0.0)};
+			
+			if (waitlist.byPassenger.find(entry.passengerUsername) != waitlist.byPassenger.end())
+			{
+				continue;
+			}
+			
+			insertEntry(waitlist, entry);
+			waitlist.nextSequence = std::max(waitlist.nextSequence, entry.sequence + 1);
+		}
+	}
+}
+
+void WaitlistManager::insertEntry(FlightWaitlist& waitlist, const WaitlistEntry& entry)
+{
+	CabinWaitlist& cabinWaitlist = waitlist.cabins[entry.cabin];
+	waitlist.byPassenger[entry.passengerUsername] = cabinWaitlist.queue.insert(entry).first;
+	++cabinWaitlist.tierCounts[static_cast<int>(entry.priority)];
+}
+
+void WaitlistManager::restoreEntry(const string& flightNumber, const WaitlistEntry& entry)
+{
+	// The passenger keeps their place: same sequence, so the same position
+	std::lock_guard<std::mutex> lock(mutex);
+	FlightWaitlist& waitlist = waitlists[flightNumber];
+	if (waitlist.byPassenger.find(entry.passengerUsername) == waitlist.byPassenger.end())
+	{
+		insertEntry(waitlist, entry);
+	}
+}
+
+void WaitlistManager::eraseEntry(FlightWaitlist& waitlist, const string& passengerUsername)
+{
+	auto it = waitlist.byPassenger.find(passengerUsername);
+	if (it == waitlist.byPassenger.end())
+	{
+		return;
+	}
+	
+	CabinWaitlist& cabinWaitlist = waitlist.cabins[it->second->cabin];
+	--cabinWaitlist.tierCounts[static_cast<int>(it->second->priority)];
+	cabinWaitlist.queue.erase(it->second);
+	waitlist.byPassenger.erase(it);
+}
+
+void WaitlistManager::persistEntry(const string& flightNumber, const WaitlistEntry& entry)
+{
+	json data;
+	data["nextSequence"] = entry.sequence + 1;
+	data["entries"][std::to_string(entry.sequence)] = entryToJson(entry);
+	
+	try
+	{
+		// A flight's first entry creates its record; later changes are single journal lines
+		if (db->entryExists(flightNumber))
+			db->journalEntry(flightNumber, data);
+		else
+			db->addEntry(flightNumber, data);
+	}
+	catch (const DatabaseException&)
+	{
+		throw ReservationException("Database error occurred while processing waitlist.");
+	}
+}
+
+void WaitlistManager::persistRemoval(const string& flightNumber, uint64_t sequence)
+{
+	json data;
+	data["entries"][std::to_string(sequence)] = nullptr;	// Merge-patch null removes the entry
+	
+	try
+	{
+		db->journalEntry(flightNumber, data);
+	}
+	catch (const DatabaseException&)
+	{
+		throw ReservationException("Database error occurred while processing waitlist.");
+	}
+}
+
+json WaitlistManager::entryToJson(const WaitlistEntry& entry)
+{
+	return json{
+		{"passengerUsername", entry.passengerUsername},
+		{"agentUsername", entry.agentUsername},
+		{"priority", static_cast<int>(entry.priority)},
+		{"requestedAt", entry.requestedAt},
+		{"cabin", entry.cabin},
+		{"quotedFare", entry.quotedFare}
+	};
+}
@@ -3,6 +3,7 @@
 #include "FlightManager.hpp"
 #include "AircraftManager.hpp"
 #include "UserInterface.hpp"
+#include "JobScheduler.hpp"
 #include "CrewManager.hpp"
 #include "ReportGenerator.hpp"
 #include <vector>
@@ -29,6 +30,7 @@ void Administrator::userMenu()
 	
 	while (true)
 	{
+		JobScheduler::getInstance()->runDueJobs();
 		ui->clearScreen();
 		
 		vector<string> options = {
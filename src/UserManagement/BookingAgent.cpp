@@ -3,6 +3,7 @@
 #include "ReservationManager.hpp"
 #include "UsersManager.hpp"
 #include "UserInterface.hpp"
+#include "JobScheduler.hpp"
 #include <vector>
 
 // ==================== Constructors ====================
@@ -26,14 +27,18 @@ void BookingAgent::userMenu()
 	
 	while (true)
 	{
+		JobScheduler::getInstance()->runDueJobs();
 		ui->clearScreen();
 		
 		vector<string> options = {
 			"Search Flights",
 			"Create Reservation",
+			"Create Group Reservation",
+			"Import Reservations",
 			"View Reservations",
 			"Modify Reservation",
 			"Cancel Reservation",
+			"Check In Flight",
 			"Resigter New Passenger",
 			"Logout"
 		};
@@ -42,7 +47,7 @@ void BookingAgent::userMenu()
 		
 		try
 		{
-			int choice = ui->getChoice("Enter choice: ", 1, 7);
+			int choice = ui->getChoice("Enter choice: ", 1, 10);
 			
 			switch (choice)
 			{
@@ -53,18 +58,27 @@ void BookingAgent::userMenu()
 					ReservationManager::getInstance()->createReservation(username);
 					break;
 				case 3:
-					ReservationManager::getInstance()->viewReservations(username, UserRole::BOOKING_AGENT);
+					ReservationManager::getInstance()->createGroupReservation(username);
 					break;
 				case 4:
-					ReservationManager::getInstance()->modifyReservation(username);
+					ReservationManager::getInstance()->importReservations(username);
 					break;
 				case 5:
-					ReservationManager::getInstance()->cancelReservation(username);
+					ReservationManager::getInstance()->viewReservations(username, UserRole::BOOKING_AGENT);
 					break;
 				case 6:
-					UsersManager::getInstance()->createNewPassenger();
+					ReservationManager::getInstance()->modifyReservation(username);
 					break;
 				case 7:
+					ReservationManager::getInstance()->cancelReservation(username);
+					break;
+				case 8:
+					ReservationManager::getInstance()->checkInFlight();
+					break;
+				case 9:
+					UsersManager::getInstance()->createNewPassenger();
+					break;
+				case 10:
 					ui->printSuccess("User " + username + " logged out successfully.");
 					return;
 				default:
@@ -2,6 +2,7 @@
 #include "FlightManager.hpp"
 #include "ReservationManager.hpp"
 #include "UserInterface.hpp"
+#include "JobScheduler.hpp"
 #include <vector>
 
 // ==================== Constructors ====================
@@ -25,6 +26,7 @@ void Passenger::userMenu()
 	
 	while (true)
 	{
+		JobScheduler::getInstance()->runDueJobs();
 		ui->clearScreen();
 		
 		vector<string> options = {
@@ -614,3 +614,8 @@ bool UsersManager::userExists(const string& username)
 {
 	return db->entryExists(username);
 }
+
+vector<bool> UsersManager::usersExist(const vector<string>& usernames)
+{
+	return db->entriesExist(usernames);
+}
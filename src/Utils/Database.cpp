@@ -9,8 +9,10 @@ namespace fs = std::filesystem;
 Database::Database(const string& entityName) 
 {
 	filePath = "Databases/" + entityName + ".json";
+	journalPath = "Databases/" + entityName + ".journal";
 	initializeIfNotExists();
 	loadFromFile();
+	replayJournal();
 }
 
 // ==================== Private Helper Methods ====================
@@ -77,12 +79,95 @@ void Database::writeToFile() const
 	}
 	
 	file.close();
+	
+	if (!file)
+	{
+		throw DatabaseException("Error writing to database file.");
+	}
+	
+	// Full snapshot now contains every journaled update
+	std::ofstream journal(journalPath, std::ios::trunc);
+	journalRecords = 0;
+}
+
+void Database::replayJournal()
+{
+	std::ifstream journal(journalPath);
+	
+	if (!journal.is_open())
+	{
+		return;
+	}
+	
+	string line;
+	while (std::getline(journal, line))
+	{
+		if (line.empty())
+		{
+			continue;
+		}
+		
+		try
+		{
+			json record = json::parse(line);
+			++journalRecords;
+			
+			// Upsert records add, replace and remove whole entries
+			if (record.contains("upsert"))
+			{
+				for (const auto& [entryKey, entryData] : record.at("upsert").items())
+				{
+					(*cachedData)[entryKey] = entryData;
+				}
+				for (const auto& entryKey : record.at("erase"))
+				{
+					cachedData->erase(entryKey.get<string>());
+				}
+				continue;
+			}
+			
+			// Batch records carry several entries; they were written as a single line
+			json updatesByKey = record.contains("batch") ? record.at("batch")
+			                                              : json{{record.at("key").get<string>(), record.at("updates")}};
+			for (const auto& [entryKey, updates] : updatesByKey.items())
+			{
+				if (cachedData->contains(entryKey))
+				{
+					(*cachedData)[entryKey].merge_patch(updates);
+				}
+			}
+		}
+		catch (const json::exception& e)
+		{
+			// A torn final record from an interrupted write ends the replay
+			break;
+		}
+	}
+}
+
+void Database::compactJournal()
+{
+	if (++journalRecords < JOURNAL_COMPACTION_RECORDS)
+	{
+		return;
+	}
+	
+	try
+	{
+		writeToFile();
+	}
+	catch (const DatabaseException&)
+	{
+		// The append already succeeded and the journal is kept, so the next append retries
+	}
 }
 
 // ==================== File Operations ====================
 
 json Database::loadAll() const
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (cachedData)
 	{
 		return *cachedData;
@@ -92,6 +177,8 @@ json Database::loadAll() const
 
 void Database::saveAll(const json& data)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	cachedData = std::make_unique<json>(data);
 	writeToFile();
 }
@@ -100,6 +187,8 @@ void Database::saveAll(const json& data)
 
 json Database::getEntry(const string& entryKey) const
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		throw DatabaseException("An error occurred while accessing the database.");
@@ -115,6 +204,8 @@ json Database::getEntry(const string& entryKey) const
 
 void Database::addEntry(const string& entryKey, const json& entryData)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		cachedData = std::make_unique<json>(json::object());
@@ -131,6 +222,8 @@ void Database::addEntry(const string& entryKey, const json& entryData)
 
 void Database::deleteEntry(const string& entryKey)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		throw DatabaseException("An error occurred while accessing the database.");
@@ -147,6 +240,8 @@ void Database::deleteEntry(const string& entryKey)
 
 bool Database::entryExists(const string& entryKey) const
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		return false;
@@ -157,6 +252,8 @@ bool Database::entryExists(const string& entryKey) const
 
 void Database::updateEntry(const string& entryKey, const json& updates)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		throw DatabaseException("An error occurred while accessing the database.");
@@ -175,10 +272,241 @@ void Database::updateEntry(const string& entryKey, const json& updates)
 	writeToFile();
 }
 
+std::vector<bool> Database::entriesExist(const std::vector<string>& entryKeys) const
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
+	std::vector<bool> exists(entryKeys.size(), false);
+	if (cachedData)
+	{
+		for (size_t i = 0; i < entryKeys.size(); ++i)
+		{
+			exists[i] = cachedData->contains(entryKeys[i]);
+		}
+	}
+	return exists;
+}
+
+void Database::upsertEntries(const json& entries)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
+	if (!entries.is_object())
+	{
+		throw DatabaseException("An error occurred while accessing the database.");
+	}
+	
+	if (entries.empty())
+	{
+		return;
+	}
+	
+	if (!cachedData)
+	{
+		cachedData = std::make_unique<json>(json::object());
+	}
+	
+	// Prior values of the touched keys, so a failed write leaves the cache as it was
+	json previous = json::object();
+	std::vector<string> added;
+	for (const auto& [key, value] : entries.items())
+	{
+		if (cachedData->contains(key))
+		{
+			previous[key] = std::move((*cachedData)[key]);
+		}
+		else
+		{
+			added.push_back(key);
+		}
+		(*cachedData)[key] = value;
+	}
+	
+	try
+	{
+		writeToFile();
+	}
+	catch (...)
+	{
+		for (const string& key : added)
+		{
+			cachedData->erase(key);
+		}
+		for (auto& [key, value] : previous.items())
+		{
+			(*cachedData)[key] = std::move(value);
+		}
+		throw;
+	}
+}
+
+void Database::deleteEntries(const std::vector<string>& entryKeys)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
+	if (!cachedData)
+	{
+		throw DatabaseException("An error occurred while accessing the database.");
+	}
+	
+	json removed = json::object();
+	for (const string& entryKey : entryKeys)
+	{
+		auto it = cachedData->find(entryKey);
+		if (it != cachedData->end())
+		{
+			removed[entryKey] = std::move(*it);
+			cachedData->erase(it);
+		}
+	}
+	
+	if (removed.empty())
+	{
+		return;
+	}
+	
+	try
+	{
+		writeToFile();
+	}
+	catch (...)
+	{
+		for (auto& [key, value] : removed.items())
+		{
+			(*cachedData)[key] = std::move(value);
+		}
+		throw;
+	}
+}
+
+void Database::journalEntry(const string& entryKey, const json& updates)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
+	if (!cachedData)
+	{
+		throw DatabaseException("An error occurred while accessing the database.");
+	}
+	
+	if (!cachedData->contains(entryKey))
+	{
+		throw DatabaseException("Entry does not exist in database.");
+	}
+	
+	std::ofstream journal(journalPath, std::ios::app);
+	
+	if (!journal.is_open())
+	{
+		throw DatabaseException("Error writing to database journal.");
+	}
+	
+	json record;
+	record["key"] = entryKey;
+	record["updates"] = updates;
+	journal << record.dump() << "\n";
+	journal.flush();
+	
+	if (!journal)
+	{
+		throw DatabaseException("Error writing to database journal.");
+	}
+	
+	// Merge-patch semantics: nested objects update only the fields they name
+	(*cachedData)[entryKey].merge_patch(updates);
+	compactJournal();
+}
+
+void Database::journalEntries(const json& updatesByKey)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
+	if (!cachedData)
+	{
+		throw DatabaseException("An error occurred while accessing the database.");
+	}
+	
+	for (const auto& [entryKey, updates] : updatesByKey.items())
+	{
+		if (!cachedData->contains(entryKey))
+		{
+			throw DatabaseException("Entry does not exist in database.");
+		}
+	}
+	
+	std::ofstream journal(journalPath, std::ios::app);
+	
+	if (!journal.is_open())
+	{
+		throw DatabaseException("Error writing to database journal.");
+	}
+	
+	// One line for the whole batch: a torn write drops every entry, never just some
+	json record;
+	record["batch"] = updatesByKey;
+	journal << record.dump() << "\n";
+	journal.flush();
+	
+	if (!journal)
+	{
+		throw DatabaseException("Error writing to database journal.");
+	}
+	
+	for (const auto& [entryKey, updates] : updatesByKey.items())
+	{
+		(*cachedData)[entryKey].merge_patch(updates);
+	}
+	compactJournal();
+}
+
+void Database::journalUpserts(const json& entries, const std::vector<string>& deletedKeys)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
+	if (!cachedData || !entries.is_object())
+	{
+		throw DatabaseException("An error occurred while accessing the database.");
+	}
+	
+	if (entries.empty() && deletedKeys.empty())
+	{
+		return;
+	}
+	
+	std::ofstream journal(journalPath, std::ios::app);
+	
+	if (!journal.is_open())
+	{
+		throw DatabaseException("Error writing to database journal.");
+	}
+	
+	json record;
+	record["upsert"] = entries;
+	record["erase"] = deletedKeys;
+	journal << record.dump() << "\n";
+	journal.flush();
+	
+	if (!journal)
+	{
+		throw DatabaseException("Error writing to database journal.");
+	}
+	
+	for (const auto& [entryKey, entryData] : entries.items())
+	{
+		(*cachedData)[entryKey] = entryData;
+	}
+	for (const string& entryKey : deletedKeys)
+	{
+		cachedData->erase(entryKey);
+	}
+	compactJournal();
+}
+
 // ==================== Attribute Operations ====================
 
 auto Database::getAttribute(const string& entryKey, const string& attributeKey) const
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		throw DatabaseException("An error occurred while accessing the database.");
@@ -201,6 +529,8 @@ auto Database::getAttribute(const string& entryKey, const string& attributeKey)
 
 void Database::setAttribute(const string& entryKey, const string& attributeKey, const json& value)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		throw DatabaseException("An error occurred while accessing the database.");
@@ -217,6 +547,8 @@ void Database::setAttribute(const string& entryKey, const string& attributeKey,
 
 void Database::deleteAttribute(const string& entryKey, const string& attributeKey)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		throw DatabaseException("An error occurred while accessing the database.");
@@ -238,6 +570,8 @@ void Database::deleteAttribute(const string& entryKey, const string& attributeKe
 
 bool Database::attributeExists(const string& entryKey, const string& attributeKey) const
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (!cachedData)
 	{
 		return false;
@@ -255,6 +589,8 @@ bool Database::attributeExists(const string& entryKey, const string& attributeKe
 
 int Database::getEntryCount() const
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	if (cachedData)
 	{
 		return cachedData->size();
@@ -269,6 +605,8 @@ bool Database::isEmpty() const
 
 void Database::clear()
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	
 	cachedData = std::make_unique<json>(json::object());
 	writeToFile();
 }
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <unordered_set>
+#include "IdempotencyStore.hpp"
+
+// ==================== Constructor ====================
+
+IdempotencyStore::IdempotencyStore(const string& entityName, std::chrono::seconds timeToLive, size_t capacity)
+	: db(std::make_unique<Database>(entityName)), timeToLive(timeToLive), capacity(std::max<size_t>(capacity, 1))
+{
+	json allData = db->loadAll();
+	for (const auto& [key, data] : allData.items())
+	{
+		if (data.contains("result"))
+		{
+			records[key] = Record{data["result"], data.value("createdAt", int64_t(0))};
+			insertionOrder.emplace_back(records[key].createdAt, key);
+		}
+	}
+	
+	std::sort(insertionOrder.begin(), insertionOrder.end());
+	
+	std::lock_guard<std::mutex> lock(mutex);
+	vector<string> removed;
+	evict(currentTime(), removed);
+	persist({}, removed);
+}
+
+// ==================== Lookup & Record ====================
+
+bool IdempotencyStore::lookup(const string& key, json& result)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	auto it = records.find(key);
+	if (it == records.end() || it->second.createdAt + timeToLive.count() <= currentTime())
+	{
+		return false;
+	}
+	
+	result = it->second.result;
+	return true;
+}
+
+void IdempotencyStore::record(const string& key, const json& result)
+{
+	recordAll({{key, result}});
+}
+
+void IdempotencyStore::recordAll(const vector<std::pair<string, json>>& results)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	int64_t now = currentTime();
+	vector<string> added;
+	vector<string> removed;
+	evict(now, removed);
+	
+	for (const auto& [key, result] : results)
+	{
+		if (records.find(key) != records.end())
+		{
+			continue;
+		}
+		
+		records[key] = Record{result, now};
+		insertionOrder.emplace_back(now, key);
+		added.push_back(key);
+	}
+	
+	// Over capacity: the oldest keys go first, even if they have not expired yet
+	while (records.size() > capacity && !insertionOrder.empty())
+	{
+		popOldest(removed);
+	}
+	
+	// Keys added in this call are written as upserts only; those already evicted again are not written at all
+	std::unordered_set<string> addedKeys(added.begin(), added.end());
+	removed.erase(std::remove_if(removed.begin(), removed.end(),
+		[&addedKeys](const string& key) { return addedKeys.count(key) > 0; }), removed.end());
+	added.erase(std::remove_if(added.begin(), added.end(),
+		[this](const string& key) { return records.find(key) == records.end(); }), added.end());
+	
+	persist(added, removed);
+}
+
+size_t IdempotencyStore::size()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return records.size();
+}
+
+// ==================== Helper Methods ====================
+
+void IdempotencyStore::evict(int64_t now, vector<string>& removed)
+{
+	while (!insertionOrder.empty() && insertionOrder.front().first + timeToLive.count() <= now)
+	{
+		popOldest(removed);
+	}
+}
+
+void IdempotencyStore::popOldest(vector<string>& removed)
+{
+	records.erase(insertionOrder.front().second);
+	removed.push_back(std::move(insertionOrder.front().second));
+	insertionOrder.pop_front();
+}
+
+void IdempotencyStore::persist(const vector<string>& added, const vector<string>& removed)
+{
+	if (added.empty() && removed.empty())
+	{
+		return;
+	}
+	
+	json entries = json::object();
+	for (const string& key : added)
+	{
+		const Record& record = records.at(key);
+		entries[key] = {{"result", record.result}, {"createdAt", record.createdAt}};
+	}
+	db->journalUpserts(entries, removed);
+}
+
+int64_t IdempotencyStore::currentTime()
+{
+	return std::chrono::duration_cast<std::chrono::seconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <limits>
+#include "IntervalTree.hpp"
+
+// ==================== Updates ====================
+
+void IntervalTree::insert(const string& key, std::time_t start, std::time_t end)
+{
+	auto existing = std::find_if(intervals.begin(), intervals.end(),
+	                             [&key](const Interval& interval) { return interval.key == key; });
+	if (existing != intervals.end())
+	{
+		if (existing->start == start && existing->end == end)
+		{
+			return;
+		}
+		intervals.erase(existing);
+	}
+	
+	if (start < end)
+	{
+		auto next = std::upper_bound(intervals.begin(), intervals.end(), start,
+		                             [](std::time_t value, const Interval& interval) { return value < interval.start; });
+		intervals.insert(next, Interval{start, end, key});
+	}
+	
+	maxEnd.resize(intervals.size());
+	buildMaxEnd(0, intervals.size());
+}
+
+bool IntervalTree::erase(const string& key)
+{
+	auto existing = std::find_if(intervals.begin(), intervals.end(),
+	                             [&key](const Interval& interval) { return interval.key == key; });
+	if (existing == intervals.end())
+	{
+		return false;
+	}
+	
+	intervals.erase(existing);
+	maxEnd.resize(intervals.size());
+	buildMaxEnd(0, intervals.size());
+	return true;
+}
+
+void IntervalTree::assign(vector<std::tuple<string, std::time_t, std::time_t>> entries)
+{
+	intervals.clear();
+	intervals.reserve(entries.size());
+	for (auto& [key, start, end] : entries)
+	{
+		if (start < end)
+		{
+			intervals.push_back(Interval{start, end, std::move(key)});
+		}
+	}
+	
+	std::stable_sort(intervals.begin(), intervals.end(),
+	                 [](const Interval& a, const Interval& b) { return a.start < b.start; });
+	maxEnd.resize(intervals.size());
+	buildMaxEnd(0, intervals.size());
+}
+
+// ==================== Queries ====================
+
+bool IntervalTree::overlaps(std::time_t start, std::time_t end) const
+{
+	return start < end && collectOverlapping(0, intervals.size(), start, end, nullptr);
+}
+
+vector<string> IntervalTree::findOverlapping(std::time_t start, std::time_t end) const
+{
+	vector<string> matches;
+	if (start < end)
+	{
+		collectOverlapping(0, intervals.size(), start, end, &matches);
+	}
+	return matches;
+}
+
+size_t IntervalTree::size() const noexcept
+{
+	return intervals.size();
+}
+
+bool IntervalTree::empty() const noexcept
+{
+	return intervals.empty();
+}
+
+// ==================== Helper Methods ====================
+
+std::time_t IntervalTree::buildMaxEnd(size_t low, size_t high)
+{
+	if (low >= high)
+	{
+		return std::numeric_limits<std::time_t>::min();
+	}
+	
+	size_t mid = low + (high - low) / 2;
+	maxEnd[mid] = std::max({intervals[mid].end, buildMaxEnd(low, mid), buildMaxEnd(mid + 1, high)});
+	return maxEnd[mid];
+}
+
+bool IntervalTree::collectOverlapping(size_t low, size_t high, std::time_t start, std::time_t end,
+                                      vector<string>* matches) const
+{
+	if (low >= high)
+	{
+		return false;
+	}
+	
+	size_t mid = low + (high - low) / 2;
+	if (maxEnd[mid] <= start)
+	{
+		return false;	// Everything in this range ends before the window opens
+	}
+	
+	bool found = collectOverlapping(low, mid, start, end, matches);
+	if ((found && !matches) || intervals[mid].start >= end)
+	{
+		return found;	// The root and the right half start after the window closes
+	}
+	
+	if (intervals[mid].end > start)
+	{
+		found = true;
+		if (!matches)
+			return true;
+		matches->push_back(intervals[mid].key);
+	}
+	
+	return collectOverlapping(mid + 1, high, start, end, matches) || found;
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include "JobScheduler.hpp"
+#include "UserInterface.hpp"
+
+// Static member initialization
+JobScheduler* JobScheduler::instance = nullptr;
+
+// ==================== Constructor & Singleton ====================
+
+JobScheduler::JobScheduler() : running(false) {}
+
+JobScheduler* JobScheduler::getInstance()
+{
+	if (instance == nullptr)
+	{
+		instance = new JobScheduler();
+	}
+	return instance;
+}
+
+// ==================== Job Registration ====================
+
+void JobScheduler::scheduleRecurring(const string& name, std::chrono::seconds interval, std::function<void()> task)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	auto nextRun = std::chrono::steady_clock::now() + interval;
+	auto it = std::find_if(jobs.begin(), jobs.end(), [&name](const Job& job) { return job.name == name; });
+	if (it != jobs.end())
+	{
+		it->interval = interval;
+		it->nextRun = nextRun;
+		it->task = std::move(task);
+		return;
+	}
+	
+	jobs.push_back(Job{name, interval, nextRun, std::move(task)});
+}
+
+void JobScheduler::cancel(const string& name)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	
+	jobs.erase(std::remove_if(jobs.begin(), jobs.end(), [&name](const Job& job) { return job.name == name; }),
+	           jobs.end());
+}
+
+// ==================== Execution ====================
+
+void JobScheduler::runDueJobs()
+{
+	vector<Job> due;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		
+		if (running)
+		{
+			return;
+		}
+		
+		auto now = std::chrono::steady_clock::now();
+		for (Job& job : jobs)
+		{
+			if (job.nextRun <= now)
+			{
+				due.push_back(job);
+				job.nextRun = now + job.interval;
+			}
+		}
+		
+		running = !due.empty();
+	}
+	
+	// Run outside the lock so jobs may register or cancel jobs themselves
+	for (const Job& job : due)
+	{
+		try
+		{
+			job.task();
+		}
+		catch (const std::exception& e)
+		{
+			// A failed run is retried on the next interval
+			UserInterface::getInstance()->printError("Scheduled job " + job.name + " failed: " + string(e.what()));
+		}
+	}
+	
+	std::lock_guard<std::mutex> lock(mutex);
+	running = false;
+}
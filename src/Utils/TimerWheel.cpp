@@ -0,0 +1,119 @@
+#include <algorithm>
+#include "TimerWheel.hpp"
+
+// ==================== Constructor ====================
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tickDuration, size_t slotCount)
+	: tickDuration(std::max(tickDuration, std::chrono::milliseconds(1))), slots(std::max<size_t>(slotCount, 1)),
+	  currentTick(0), lastTickTime(std::chrono::steady_clock::now()), nextTimerId(1)
+{
+}
+
+// ==================== Timer Operations ====================
+
+uint64_t TimerWheel::schedule(std::chrono::milliseconds delay)
+{
+	// Round up so a timer never fires early; always at least one tick away
+	uint64_t ticks = static_cast<uint64_t>((delay.count() + tickDuration.count() - 1) / tickDuration.count());
+	ticks = std::max<uint64_t>(ticks, 1);
+	
+	Timer timer;
+	timer.expiryTick = currentTick + ticks;
+	timer.slot = timer.expiryTick % slots.size();
+	timer.position = slots[timer.slot].size();
+	
+	uint64_t timerId = nextTimerId++;
+	slots[timer.slot].push_back(timerId);
+	timers[timerId] = timer;
+	return timerId;
+}
+
+bool TimerWheel::cancel(uint64_t timerId)
+{
+	auto it = timers.find(timerId);
+	if (it == timers.end())
+	{
+		return false;
+	}
+	
+	removeFromSlot(it->second);
+	timers.erase(it);
+	return true;
+}
+
+bool TimerWheel::isPending(uint64_t timerId) const
+{
+	return timers.find(timerId) != timers.end();
+}
+
+size_t TimerWheel::size() const noexcept
+{
+	return timers.size();
+}
+
+// ==================== Advancing ====================
+
+vector<uint64_t> TimerWheel::advance()
+{
+	return advance(std::chrono::steady_clock::now());
+}
+
+vector<uint64_t> TimerWheel::advance(std::chrono::steady_clock::time_point now)
+{
+	vector<uint64_t> expired;
+	
+	if (now <= lastTickTime)
+	{
+		return expired;
+	}
+	
+	uint64_t elapsed = static_cast<uint64_t>((now - lastTickTime) / tickDuration);
+	if (elapsed == 0)
+	{
+		return expired;
+	}
+	
+	uint64_t targetTick = currentTick + elapsed;
+	uint64_t slotsToVisit = std::min<uint64_t>(elapsed, slots.size());
+	
+	for (uint64_t step = 1; step <= slotsToVisit; ++step)
+	{
+		vector<uint64_t>& slot = slots[(currentTick + step) % slots.size()];
+		
+		// Timers due on a later rotation stay in place
+		for (size_t i = 0; i < slot.size(); )
+		{
+			uint64_t timerId = slot[i];
+			auto it = timers.find(timerId);
+			if (it->second.expiryTick <= targetTick)
+			{
+				removeFromSlot(it->second);
+				timers.erase(it);
+				expired.push_back(timerId);
+			}
+			else
+			{
+				++i;
+			}
+		}
+	}
+	
+	currentTick = targetTick;
+	lastTickTime += tickDuration * elapsed;
+	return expired;
+}
+
+// ==================== Helper Methods ====================
+
+void TimerWheel::removeFromSlot(const Timer& timer)
+{
+	vector<uint64_t>& slot = slots[timer.slot];
+	
+	// Swap-remove, then fix up the moved timer's position
+	if (timer.position != slot.size() - 1)
+	{
+		slot[timer.position] = slot.back();
+		timers[slot[timer.position]].position = timer.position;
+	}
+	slot.pop_back();
+}
@@ -323,64 +323,79 @@ void UserInterface::displayGrid(const vector<string>& rowLabels,
                                 const vector<vector<string>>& gridData,
                                 const GridDisplayConfig& config)
 {
-	// Display title if provided
+	if (rowLabels.size() != gridData.size())
+	{
+		printError("Row labels and grid data size mismatch");
+		return;
+	}
+	
+	// Assemble the whole grid first and emit it with a single write and flush
+	string buffer;
+	size_t cellCount = 0;
+	for (const auto& row : gridData)
+	{
+		cellCount += row.size();
+	}
+	buffer.reserve(512 + rowLabels.size() * 16 + cellCount * 6);
+	
+	// Title
 	if (!config.title.empty())
 	{
-		printHeader(config.title);
+		buffer += "\n" + string(50, '=') + "\n  " + config.title + "\n" + string(50, '=') + "\n";
 	}
 	
-	// Display header lines
+	// Header lines
 	if (!config.headerLines.empty())
 	{
 		for (const auto& line : config.headerLines)
 		{
-			println(line);
+			buffer += line + "\n";
 		}
-		println("");
+		buffer += "\n";
 	}
 	
-	// Display legend
+	// Legend
 	if (!config.legend.empty())
 	{
 		for (const auto& line : config.legend)
 		{
-			println(line);
+			buffer += line + "\n";
 		}
 		if (config.showSeparator)
 		{
-			printSeparator();
+			buffer += string(50, '-') + "\n";
 		}
 	}
 	
-	// Display grid data
-	if (rowLabels.size() != gridData.size())
-	{
-		printError("Row labels and grid data size mismatch");
-		return;
-	}
-	
+	// Grid rows: label left-aligned in 12 columns, then each cell followed by a space
 	for (size_t i = 0; i < rowLabels.size(); ++i)
 	{
-		// Print row label
-		std::cout << std::left << std::setw(12) << rowLabels[i];
+		buffer += rowLabels[i];
+		if (rowLabels[i].size() < 12)
+		{
+			buffer.append(12 - rowLabels[i].size(), ' ');
+		}
 		
-		// Print grid cells
 		for (const auto& cell : gridData[i])
 		{
-			std::cout << cell << " ";
+			buffer += cell;
+			buffer += ' ';
 		}
-		println("");
+		buffer += '\n';
 	}
 	
-	// Display footer lines
+	// Footer lines
 	if (!config.footerLines.empty())
 	{
-		println("");
+		buffer += "\n";
 		for (const auto& line : config.footerLines)
 		{
-			println(line);
+			buffer += line + "\n";
 		}
 	}
+	
+	std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	std::cout.flush();
 }
 
 // ==================== Formatting Utilities ====================